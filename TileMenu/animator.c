@@ -9,6 +9,11 @@ void on_animation_stopped(Animation *anim, bool finished, void *context) {
 void animate_layer(Layer *layer, GRect *start, GRect *finish, int duration, int delay) {
     //Declare animation
     PropertyAnimation *anim = property_animation_create_layer_frame(layer, start, finish);
+    //Snap to the final frame if the heap could not fit the animation
+    if(!anim) {
+        layer_set_frame(layer, *finish);
+        return;
+    }
  
     //Set characteristics
     animation_set_duration((Animation*) anim, duration);
@@ -0,0 +1,90 @@
+/** Flick Detector
+ */
+#include "flick.h"
+
+// Baseline is kept scaled by 2^FLICK_BASELINE_SHIFT and follows 1/2^FLICK_BASELINE_SHIFT of each sample
+#define FLICK_BASELINE_SHIFT    3
+
+void flick_detector_init(FlickDetector * detector) {
+    if(!detector)
+        return;
+
+    detector->baseline = 0;
+    detector->threshold = FLICK_DEFAULT_THRESHOLD;
+    detector->row_step = FLICK_DEFAULT_ROW_STEP;
+    detector->peak = 0;
+    detector->max_rows = FLICK_DEFAULT_MAX_ROWS;
+    detector->refractory = FLICK_DEFAULT_REFRACTORY;
+    detector->max_spike = FLICK_DEFAULT_MAX_SPIKE;
+    detector->spike_length = 0;
+    detector->refractory_left = 0;
+    detector->direction = 0;
+    detector->last_direction = 0;
+    detector->suppressed = false;
+    detector->primed = false;
+}
+
+static int flick_detector_rows(FlickDetector * detector) {
+    int32_t rows = 1 + (detector->row_step > 0 ? (detector->peak - detector->threshold) / detector->row_step : 0);
+    return (rows > detector->max_rows ? detector->max_rows : rows);
+}
+
+int flick_detector_process(FlickDetector * detector, const FlickSample * samples, uint32_t num_samples) {
+    if(!detector || !samples)
+        return 0;
+
+    int rows = 0;
+    for(uint32_t i = 0; i < num_samples; ++i) {
+        int32_t value = samples[i].y;
+
+        // The vibe motor shakes the wrist harder than most flicks
+        if(samples[i].did_vibrate) {
+            detector->direction = 0;
+            detector->primed = false;
+            continue;
+        }
+        if(!detector->primed) {
+            detector->baseline = value << FLICK_BASELINE_SHIFT;
+            detector->primed = true;
+            continue;
+        }
+
+        int32_t delta = value - (detector->baseline >> FLICK_BASELINE_SHIFT);
+        int8_t direction = (delta < 0 ? -1 : 1);
+        int32_t magnitude = (delta < 0 ? -delta : delta);
+        if(detector->refractory_left > 0)
+            detector->refractory_left--;
+
+        if(detector->direction != 0) {
+            // Spike continues while it stays the same way above half the threshold
+            if(direction == detector->direction && magnitude >= detector->threshold / 2) {
+                if(magnitude > detector->peak)
+                    detector->peak = magnitude;
+                // Held too long to be a flick, the wrist has been tilted into a new rest position
+                if(++detector->spike_length > detector->max_spike) {
+                    detector->direction = 0;
+                    detector->baseline = value << FLICK_BASELINE_SHIFT;
+                }
+                continue;
+            }
+
+            if(!detector->suppressed) {
+                rows += detector->direction * flick_detector_rows(detector);
+                detector->last_direction = detector->direction;
+                detector->refractory_left = detector->refractory;
+            }
+            detector->direction = 0;
+        }
+
+        if(magnitude >= detector->threshold) {
+            detector->direction = direction;
+            detector->peak = magnitude;
+            detector->spike_length = 1;
+            detector->suppressed = (detector->refractory_left > 0 && direction != detector->last_direction);
+            continue;
+        }
+
+        detector->baseline += delta;
+    }
+    return rows;
+}
@@ -0,0 +1,83 @@
+/** Flick Detector
+ */
+#include <stdbool.h>
+#include <stdint.h>
+
+// Default high-passed acceleration (mG) a sample must exceed to register a flick
+#define FLICK_DEFAULT_THRESHOLD     1200
+// Default extra acceleration (mG) above the threshold needed for each additional row
+#define FLICK_DEFAULT_ROW_STEP      600
+// Default maximum rows a single flick can scroll
+#define FLICK_DEFAULT_MAX_ROWS      3
+// Default samples after a flick during which a spike the opposite way is taken as its return
+#define FLICK_DEFAULT_REFRACTORY    12
+// Default longest spike (in samples) still counted as a flick, anything held longer is a tilt
+#define FLICK_DEFAULT_MAX_SPIKE     5
+// N.B. The defaults are only checked against the synthetic traces in test/traces, not device captures
+
+/** @FlickSample **
+ *
+ *  @brief: A single accelerometer sample in mG. Mirrors the fields of
+ *          the Pebble @AccelData that the detector uses so that recorded
+ *          samples can be replayed through a @FlickDetector on the host
+ *          without the Pebble SDK.
+ */
+typedef struct _flick_sample_ {
+    int16_t x;
+    int16_t y;
+    int16_t z;
+    bool    did_vibrate;    // Sample was taken while the vibe motor was running
+} FlickSample;
+
+/** @FlickDetector **
+ *
+ *  @brief: Detects wrist flicks along the Y axis from batches of
+ *          accelerometer samples. Gravity and slow tilting are removed by
+ *          a running baseline, which is frozen while a spike is in
+ *          progress so the spike is measured against the resting wrist.
+ *
+ *          A spike only counts as a flick if it falls back within
+ *          @max_spike samples, a change that is held longer is a tilt and
+ *          becomes the new baseline instead. Once a flick is counted,
+ *          spikes the opposite way are ignored for @refractory samples so
+ *          bringing the wrist back does not undo it, while further
+ *          flicks the same way still count.
+ *
+ *          Samples taken while vibrating abandon any spike in progress
+ *          and re-seed the baseline from the next clean sample.
+ *
+ *          State is kept between batches so a flick that straddles two
+ *          batches is only counted once.
+ */
+typedef struct _flick_detector_ {
+    int32_t baseline;       // Running low-pass of the Y axis, scaled by 8
+    int16_t threshold;
+    int16_t row_step;
+    int16_t peak;           // Largest magnitude of the spike in progress
+    uint8_t max_rows;
+    uint8_t refractory;
+    uint8_t max_spike;
+    uint8_t spike_length;   // Samples so far in the spike in progress
+    uint8_t refractory_left;// Samples left in which an opposite spike is ignored
+    int8_t  direction;      // Sign of the spike in progress, 0 while at rest
+    int8_t  last_direction; // Sign of the last counted flick
+    bool    suppressed;     // Spike in progress is the return of the last flick
+    bool    primed;         // Baseline has been seeded by a sample
+} FlickDetector;
+
+/** Initialiser **
+ *
+ *  @brief: Resets a @FlickDetector with the FLICK_DEFAULT_* tuning values.
+ */
+void            flick_detector_init(FlickDetector * detector);
+
+/** Batch Processing **
+ *
+ *  @brief: Runs @num_samples samples through the @FlickDetector and
+ *          coalesces every flick found in them into a single row count.
+ *          A flick is counted on the sample that ends its spike.
+ *
+ *  @returns: The net number of rows to scroll, positive for a flick
+ *            towards the user (DOWN) and negative away from them (UP).
+ */
+int             flick_detector_process(FlickDetector * detector, const FlickSample * samples, uint32_t num_samples);
@@ -0,0 +1,59 @@
+/** IconCache
+ */
+#include "icon_cache.h"
+
+typedef struct _icon_cache_entry_ {
+    uint32_t resource_id;
+    uint16_t references;
+    GBitmap * bitmap;
+    struct _icon_cache_entry_ * next;
+} IconCacheEntry;
+
+static IconCacheEntry * s_entries = NULL;
+static int s_size = 0;
+
+GBitmap * icon_cache_acquire(uint32_t resource_id) {
+    for(IconCacheEntry * entry = s_entries; entry; entry = entry->next) {
+        if(entry->resource_id == resource_id) {
+            entry->references++;
+            return entry->bitmap;
+        }
+    }
+
+    IconCacheEntry * entry = (IconCacheEntry*)malloc(sizeof(IconCacheEntry));
+    if(!entry)
+        return NULL;
+
+    entry->bitmap = gbitmap_create_with_resource(resource_id);
+    if(!entry->bitmap) {
+        free(entry);
+        return NULL;
+    }
+
+    entry->resource_id = resource_id;
+    entry->references = 1;
+    entry->next = s_entries;
+    s_entries = entry;
+    s_size++;
+    return entry->bitmap;
+}
+
+void icon_cache_release(uint32_t resource_id) {
+    for(IconCacheEntry ** link = &s_entries; *link; link = &(*link)->next) {
+        IconCacheEntry * entry = *link;
+        if(entry->resource_id != resource_id)
+            continue;
+
+        if(--entry->references == 0) {
+            *link = entry->next;
+            gbitmap_destroy(entry->bitmap);
+            free(entry);
+            s_size--;
+        }
+        return;
+    }
+}
+
+int icon_cache_size(void) {
+    return s_size;
+}
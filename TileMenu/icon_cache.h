@@ -0,0 +1,35 @@
+/** IconCache
+ */
+#include <pebble.h>
+
+/** ICON CACHE **
+ *
+ *  @brief: An app-wide cache of icon bitmaps keyed by resource ID and
+ *          shared by every tile and TileMenu. Each bitmap is loaded on
+ *          its first acquire and reference counted, so the heap used
+ *          scales with the number of distinct icons in use rather than
+ *          the number of tiles showing them.
+ *
+ *          A bitmap is destroyed as soon as its last reference is released.
+ */
+
+/** Acquire **
+ *
+ *  @brief: Takes a reference to the bitmap of @resource_id, loading it
+ *          with gbitmap_create_with_resource() if not already cached.
+ *  @returns: The shared bitmap, NULL if it could not be loaded.
+ *
+ *  N.B. The bitmap is owned by the cache and must NOT be destroyed by the caller.
+ */
+GBitmap *       icon_cache_acquire(uint32_t resource_id);
+/** Release **
+ *
+ *  @brief: Drops a reference taken by icon_cache_acquire() and destroys
+ *          the bitmap once no references are left.
+ */
+void            icon_cache_release(uint32_t resource_id);
+/** Size **
+ *
+ *  @returns: The number of distinct bitmaps currently loaded.
+ */
+int             icon_cache_size(void);
@@ -0,0 +1,155 @@
+/** Catalog Bench
+ *
+ *  Compares a TileMenu created from a TileCatalog, which only creates the
+ *  tiles near the view, with a plain TileMenu holding a labelled tile per
+ *  record, for 10 to 1,000 records. Runs against the host shim in pebble.h
+ *  so the heap figures come from its fixed-size arena.
+ *
+ *  Each menu is scrolled through every tile and the selected tile must draw
+ *  the title of its record at each step, the bench fails if one does not.
+ *
+ *  Usage: catalog_bench
+ */
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <time.h>
+#include "tile_menu.h"
+
+#define CATALOG_BENCH_MAX_TILES 1000
+#define CATALOG_BENCH_PER_VIEW  3
+#define CATALOG_BENCH_PER_ROW   2
+
+static const unsigned s_sizes[] = { 10, 50, 100, 250, 500, CATALOG_BENCH_MAX_TILES };
+
+// Packed catalog, kept out of the arena like a resource in flash
+static uint8_t s_catalog[TILE_CATALOG_HEADER_SIZE + (CATALOG_BENCH_MAX_TILES * sizeof(TileCatalogRecord))];
+
+typedef struct _catalog_bench_result_ {
+    unsigned layers;            // Layers held by the TileMenu once drawn
+    size_t used;                // Heap bytes held by the TileMenu once drawn
+    uint32_t allocations;       // Allocations made to create and draw it
+    double create_us;
+    double step_us;             // Mean time to select the next tile
+    uint32_t reads;             // Catalog byte range reads over the whole scroll
+    bool passed;
+} CatalogBenchResult;
+
+static double catalog_bench_now_us(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (now.tv_sec * 1e6) + (now.tv_nsec / 1e3);
+}
+
+static void catalog_bench_put16(uint8_t * data, uint16_t value) {
+    data[0] = value & 0xFF;
+    data[1] = value >> 8;
+}
+
+static const char * catalog_bench_title(unsigned index) {
+    return (const char*)s_catalog + TILE_CATALOG_HEADER_SIZE + (index * sizeof(TileCatalogRecord)) + offsetof(TileCatalogRecord, title);
+}
+
+static const char * catalog_bench_subtitle(unsigned index) {
+    return (const char*)s_catalog + TILE_CATALOG_HEADER_SIZE + (index * sizeof(TileCatalogRecord)) + offsetof(TileCatalogRecord, subtitle);
+}
+
+// Packs @count records as tools/tile_catalog_pack.py would, without icons
+static size_t catalog_bench_pack(unsigned count) {
+    memset(s_catalog, 0, sizeof(s_catalog));
+    memcpy(s_catalog, TILE_CATALOG_MAGIC, 4);
+    catalog_bench_put16(s_catalog + 4, count);
+    catalog_bench_put16(s_catalog + 6, sizeof(TileCatalogRecord));
+    for(unsigned i = 0; i < count; ++i) {
+        uint8_t * record = s_catalog + TILE_CATALOG_HEADER_SIZE + (i * sizeof(TileCatalogRecord));
+        catalog_bench_put16(record + offsetof(TileCatalogRecord, action), i);
+        snprintf((char*)catalog_bench_title(i), TILE_CATALOG_TITLE_LENGTH, "Tile %u", i);
+        snprintf((char*)catalog_bench_subtitle(i), TILE_CATALOG_SUBTITLE_LENGTH, "Action %u", i);
+    }
+    return TILE_CATALOG_HEADER_SIZE + (count * sizeof(TileCatalogRecord));
+}
+
+// The selected tile must be drawing the title of the record it is selected on
+static bool catalog_bench_check(TileMenu * menu) {
+    Layer * tile = tile_menu_get_selected(menu);
+    const char * title = (tile ? host_layer_render(tile) : NULL);
+    return (title && strcmp(title, catalog_bench_title(tile_menu_get_state(menu).selected)) == 0);
+}
+
+static CatalogBenchResult catalog_bench_run(Window * window, uint32_t resource_id, unsigned count, bool catalog) {
+    CatalogBenchResult result = { 0, 0, 0, 0, 0, 0, true };
+    GRect frame = layer_get_bounds(window_get_root_layer(window));
+    GFont font = fonts_get_system_font("GOTHIC_14");
+    HostHeapStats before = host_heap_stats();
+    unsigned layers = host_layer_count();
+    double start = catalog_bench_now_us();
+
+    TileMenu * menu;
+    if(catalog) {
+        menu = tile_menu_create_with_catalog(frame, window, resource_id, font, CATALOG_BENCH_PER_VIEW, CATALOG_BENCH_PER_ROW);
+    }
+    else {
+        menu = tile_menu_create(frame, window, count, CATALOG_BENCH_PER_VIEW, CATALOG_BENCH_PER_ROW);
+        for(unsigned i = 0; menu && i < count; ++i) {
+            Layer * tile = (i == 0 ? tile_menu_get_curr(menu) : tile_menu_get_next(menu));
+            if(!tile_menu_set_tile_label(menu, tile, catalog_bench_title(i), catalog_bench_subtitle(i), font))
+                result.passed = false;
+        }
+    }
+    if(!menu) {
+        result.passed = false;
+        return result;
+    }
+    layer_add_child(window_get_root_layer(window), tile_menu_get_layer(menu));
+    tile_menu_draw(menu);
+    result.create_us = catalog_bench_now_us() - start;
+
+    HostHeapStats created = host_heap_stats();
+    result.layers = host_layer_count() - layers;
+    result.used = created.used - before.used;
+    result.allocations = created.allocations - before.allocations;
+
+    uint32_t reads = host_resource_reads();
+    double checking = 0;
+    start = catalog_bench_now_us();
+    for(unsigned i = 0; i < count; ++i) {
+        tile_menu_set_selected_next(menu);
+        // Checking is left out of the step time
+        double check = catalog_bench_now_us();
+        if(!catalog_bench_check(menu))
+            result.passed = false;
+        checking += catalog_bench_now_us() - check;
+    }
+    result.step_us = (catalog_bench_now_us() - start - checking) / count;
+    result.reads = host_resource_reads() - reads;
+
+    layer_remove_from_parent(tile_menu_get_layer(menu));
+    tile_menu_destroy(menu);
+    return result;
+}
+
+int main(void) {
+    Window * window = window_create();
+    if(!window)
+        return 1;
+
+    bool passed = true;
+    printf("%6s  %-7s  %6s  %9s  %6s  %9s  %7s  %6s\n",
+           "tiles", "menu", "layers", "heap (B)", "allocs", "create us", "step us", "reads");
+    for(unsigned i = 0; i < sizeof(s_sizes) / sizeof(s_sizes[0]); ++i) {
+        // Every size is registered as its own resource over the one buffer, packed just before it runs
+        uint32_t resource_id = i + 1;
+        host_resource_add(resource_id, s_catalog, catalog_bench_pack(s_sizes[i]));
+
+        for(int catalog = 1; catalog >= 0; --catalog) {
+            CatalogBenchResult result = catalog_bench_run(window, resource_id, s_sizes[i], catalog);
+            printf("%6u  %-7s  %6u  %9zu  %6u  %9.1f  %7.2f  %6u%s\n",
+                   s_sizes[i], (catalog ? "catalog" : "plain"), result.layers, result.used,
+                   result.allocations, result.create_us, result.step_us, result.reads,
+                   (result.passed ? "" : "  FAIL"));
+            passed = passed && result.passed;
+        }
+    }
+
+    window_destroy(window);
+    return (passed ? 0 : 1);
+}
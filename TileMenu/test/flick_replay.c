@@ -0,0 +1,98 @@
+/** Flick Replay
+ *
+ *  Replays accelerometer traces through a FlickDetector on the host, in
+ *  batches the size the accel data service would deliver them. The traces
+ *  in traces/ are synthetic, hand-built rather than captured on a watch.
+ *
+ *  Trace files hold one sample per line as "x,y,z[,did_vibrate]" in mG.
+ *  Lines starting with '#' are comments, "# expect: <rows>" sets the net
+ *  rows the trace must scroll for the replay to pass.
+ *
+ *  Usage: flick_replay [-b samples_per_batch] trace...
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "flick.h"
+
+#define FLICK_REPLAY_MAX_BATCH  25
+
+static int flick_replay_trace(const char * path, uint32_t batch, bool * passed) {
+    FILE * file = fopen(path, "r");
+    if(!file) {
+        fprintf(stderr, "%s: cannot open\n", path);
+        *passed = false;
+        return 0;
+    }
+
+    FlickDetector detector;
+    flick_detector_init(&detector);
+
+    FlickSample samples[FLICK_REPLAY_MAX_BATCH];
+    uint32_t count = 0;
+    unsigned sample = 0;
+    int rows = 0;
+    int expect = 0;
+    bool expected = false;
+    char line[128];
+    while(fgets(line, sizeof(line), file)) {
+        if(line[0] == '#') {
+            if(sscanf(line, "# expect: %d", &expect) == 1)
+                expected = true;
+            continue;
+        }
+
+        int x, y, z, vibrate = 0;
+        if(sscanf(line, "%d,%d,%d,%d", &x, &y, &z, &vibrate) < 3)
+            continue;
+        samples[count++] = (FlickSample) { x, y, z, vibrate != 0 };
+        sample++;
+        if(count == batch) {
+            int batch_rows = flick_detector_process(&detector, samples, count);
+            if(batch_rows != 0)
+                printf("%s: %+d rows by sample %u\n", path, batch_rows, sample);
+            rows += batch_rows;
+            count = 0;
+        }
+    }
+    if(count > 0) {
+        int batch_rows = flick_detector_process(&detector, samples, count);
+        if(batch_rows != 0)
+            printf("%s: %+d rows by sample %u\n", path, batch_rows, sample);
+        rows += batch_rows;
+    }
+    fclose(file);
+
+    *passed = (!expected || rows == expect);
+    printf("%s: %u samples, %+d rows", path, sample, rows);
+    if(expected)
+        printf(", expected %+d %s", expect, (*passed ? "PASS" : "FAIL"));
+    printf("\n");
+    return rows;
+}
+
+int main(int argc, char ** argv) {
+    uint32_t batch = FLICK_REPLAY_MAX_BATCH;
+    int arg = 1;
+    if(arg + 1 < argc && strcmp(argv[arg], "-b") == 0) {
+        batch = (uint32_t)atoi(argv[arg + 1]);
+        if(batch < 1 || batch > FLICK_REPLAY_MAX_BATCH) {
+            fprintf(stderr, "samples_per_batch must be 1 to %d\n", FLICK_REPLAY_MAX_BATCH);
+            return 2;
+        }
+        arg += 2;
+    }
+    if(arg >= argc) {
+        fprintf(stderr, "usage: %s [-b samples_per_batch] trace...\n", argv[0]);
+        return 2;
+    }
+
+    int failures = 0;
+    for(; arg < argc; ++arg) {
+        bool passed;
+        flick_replay_trace(argv[arg], batch, &passed);
+        if(!passed)
+            failures++;
+    }
+    return (failures > 0 ? 1 : 0);
+}
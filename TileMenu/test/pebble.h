@@ -0,0 +1,177 @@
+/** Host Pebble Shim
+ *
+ *  Just enough of the Pebble SDK for TileMenu to run on the host in the
+ *  benchmarks. Layers keep real frames and child lists, animations jump
+ *  straight to their final frame and resources are blobs registered with
+ *  host_resource_add().
+ *
+ *  malloc(), calloc(), realloc() and free() are routed to a first-fit
+ *  arena of HOST_HEAP_SIZE bytes, like the fixed app heap on the watch,
+ *  so allocation counts and fragmentation can be measured.
+ */
+#pragma once
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stddef.h>
+
+// Arena size (bytes), the host has 64-bit pointers so TileMenu objects are larger than on the watch
+#ifndef HOST_HEAP_SIZE
+#define HOST_HEAP_SIZE      (512 * 1024)
+#endif
+
+typedef struct { int16_t x, y; } GPoint;
+typedef struct { int16_t w, h; } GSize;
+typedef struct { GPoint origin; GSize size; } GRect;
+#define GPoint(x,y)         ((GPoint){(x),(y)})
+#define GSize(w,h)          ((GSize){(w),(h)})
+#define GRect(x,y,w,h)      ((GRect){{(x),(y)},{(w),(h)}})
+#define GPointZero          GPoint(0,0)
+#define GRectZero           GRect(0,0,0,0)
+
+typedef struct Layer Layer;
+typedef struct Window Window;
+typedef struct ScrollLayer ScrollLayer;
+typedef struct InverterLayer InverterLayer;
+typedef struct GContext GContext;
+typedef struct GFont_ * GFont;
+typedef struct GBitmap GBitmap;
+typedef struct Animation Animation;
+typedef struct PropertyAnimation PropertyAnimation;
+typedef struct ResHandle_ * ResHandle;
+typedef void * ClickRecognizerRef;
+typedef void (*ClickConfigProvider)(void * context);
+typedef void (*ClickHandler)(ClickRecognizerRef recognizer, void * context);
+typedef void (*LayerUpdateProc)(Layer * layer, GContext * ctx);
+
+typedef enum { GColorClear = -1, GColorBlack = 0, GColorWhite = 1 } GColor;
+typedef enum { GTextOverflowModeWordWrap, GTextOverflowModeTrailingEllipsis, GTextOverflowModeFill } GTextOverflowMode;
+typedef enum { GTextAlignmentLeft, GTextAlignmentCenter, GTextAlignmentRight } GTextAlignment;
+typedef struct GTextLayout * GTextLayoutCacheRef;
+typedef enum { BUTTON_ID_BACK, BUTTON_ID_UP, BUTTON_ID_SELECT, BUTTON_ID_DOWN } ButtonId;
+typedef enum { ACCEL_SAMPLING_10HZ = 10, ACCEL_SAMPLING_25HZ = 25, ACCEL_SAMPLING_50HZ = 50, ACCEL_SAMPLING_100HZ = 100 } AccelSamplingRate;
+typedef struct { int16_t x, y, z; bool did_vibrate; uint64_t timestamp; } AccelData;
+typedef void (*AccelDataHandler)(AccelData * data, uint32_t num_samples);
+typedef struct { uint8_t charge_percent; bool is_charging; bool is_plugged; } BatteryChargeState;
+typedef void (*BatteryStateHandler)(BatteryChargeState charge);
+typedef void (*AnimationStartedHandler)(Animation * animation, void * context);
+typedef void (*AnimationStoppedHandler)(Animation * animation, bool finished, void * context);
+typedef struct { AnimationStartedHandler started; AnimationStoppedHandler stopped; } AnimationHandlers;
+typedef struct { ClickConfigProvider click_config_provider; void (*content_offset_changed_handler)(ScrollLayer * layer, void * context); } ScrollLayerCallbacks;
+
+// Heap
+size_t              heap_bytes_free(void);
+size_t              heap_bytes_used(void);
+
+// Layer
+Layer *             layer_create(GRect frame);
+Layer *             layer_create_with_data(GRect frame, size_t data_size);
+void                layer_destroy(Layer * layer);
+void *              layer_get_data(const Layer * layer);
+GRect               layer_get_frame(const Layer * layer);
+void                layer_set_frame(Layer * layer, GRect frame);
+GRect               layer_get_bounds(const Layer * layer);
+void                layer_set_bounds(Layer * layer, GRect bounds);
+void                layer_add_child(Layer * parent, Layer * child);
+void                layer_remove_from_parent(Layer * layer);
+void                layer_remove_child_layers(Layer * layer);
+void                layer_mark_dirty(Layer * layer);
+Window *            layer_get_window(const Layer * layer);
+void                layer_set_update_proc(Layer * layer, LayerUpdateProc update_proc);
+void                layer_set_hidden(Layer * layer, bool hidden);
+bool                layer_get_hidden(const Layer * layer);
+
+// Window
+Window *            window_create(void);
+void                window_destroy(Window * window);
+Layer *             window_get_root_layer(const Window * window);
+void                window_set_click_config_provider_with_context(Window * window, ClickConfigProvider provider, void * context);
+void                window_single_click_subscribe(ButtonId button, ClickHandler handler);
+
+// ScrollLayer and InverterLayer
+ScrollLayer *       scroll_layer_create(GRect frame);
+void                scroll_layer_destroy(ScrollLayer * layer);
+Layer *             scroll_layer_get_layer(const ScrollLayer * layer);
+void                scroll_layer_add_child(ScrollLayer * layer, Layer * child);
+void                scroll_layer_set_content_size(ScrollLayer * layer, GSize size);
+GSize               scroll_layer_get_content_size(const ScrollLayer * layer);
+void                scroll_layer_set_content_offset(ScrollLayer * layer, GPoint offset, bool animated);
+GPoint              scroll_layer_get_content_offset(ScrollLayer * layer);
+void                scroll_layer_set_context(ScrollLayer * layer, void * context);
+void                scroll_layer_set_callbacks(ScrollLayer * layer, ScrollLayerCallbacks callbacks);
+InverterLayer *     inverter_layer_create(GRect frame);
+void                inverter_layer_destroy(InverterLayer * layer);
+Layer *             inverter_layer_get_layer(InverterLayer * layer);
+
+// Animation
+PropertyAnimation * property_animation_create_layer_frame(Layer * layer, GRect * from, GRect * to);
+void                property_animation_destroy(PropertyAnimation * animation);
+void                animation_set_duration(Animation * animation, uint32_t duration);
+void                animation_set_delay(Animation * animation, uint32_t delay);
+void                animation_set_handlers(Animation * animation, AnimationHandlers handlers, void * context);
+void                animation_schedule(Animation * animation);
+
+// Graphics, text is measured as one 14 px line per 12 characters
+GFont               fonts_get_system_font(const char * key);
+void                graphics_context_set_text_color(GContext * ctx, GColor color);
+void                graphics_draw_text(GContext * ctx, const char * text, GFont font, GRect box, GTextOverflowMode mode, GTextAlignment alignment, GTextLayoutCacheRef layout);
+GSize               graphics_text_layout_get_content_size(const char * text, GFont font, GRect box, GTextOverflowMode mode, GTextAlignment alignment);
+void                graphics_draw_bitmap_in_rect(GContext * ctx, const GBitmap * bitmap, GRect rect);
+GBitmap *           gbitmap_create_with_resource(uint32_t resource_id);
+void                gbitmap_destroy(GBitmap * bitmap);
+GRect               gbitmap_get_bounds(const GBitmap * bitmap);
+
+// Resources
+ResHandle           resource_get_handle(uint32_t resource_id);
+size_t              resource_size(ResHandle handle);
+size_t              resource_load(ResHandle handle, uint8_t * buffer, size_t max_length);
+size_t              resource_load_byte_range(ResHandle handle, uint32_t start_offset, uint8_t * buffer, size_t num_bytes);
+
+// Services
+void                vibes_short_pulse(void);
+int                 accel_data_service_subscribe(uint32_t samples_per_update, AccelDataHandler handler);
+void                accel_data_service_unsubscribe(void);
+int                 accel_service_set_sampling_rate(AccelSamplingRate rate);
+void                battery_state_service_subscribe(BatteryStateHandler handler);
+void                battery_state_service_unsubscribe(void);
+BatteryChargeState  battery_state_service_peek(void);
+bool                gpoint_equal(const GPoint * a, const GPoint * b);
+
+#define APP_LOG(...)        ((void)0)
+
+/** Host Helpers **
+ *
+ *  @brief: Not part of the Pebble SDK, used by the benchmarks to set up
+ *          resources and read the heap arena. host_layer_render() runs the
+ *          update_proc of a visible Layer and returns the first text drawn.
+ *          host_click() runs the single click handler subscribed for a button,
+ *          @false if there is none and the Window would handle it itself.
+ */
+typedef struct _host_heap_stats_ {
+    uint32_t allocations;       // malloc(), calloc() and realloc() calls that succeeded
+    uint32_t frees;
+    uint32_t failures;          // Requests the arena could not fit
+    size_t   used;              // Bytes handed out, excluding block headers
+    size_t   peak;
+    size_t   free;              // Bytes in free blocks, excluding block headers
+    size_t   largest_free;      // Largest single request that would still fit
+    uint32_t free_blocks;
+} HostHeapStats;
+
+void *              host_malloc(size_t size);
+void *              host_calloc(size_t count, size_t size);
+void *              host_realloc(void * ptr, size_t size);
+void                host_free(void * ptr);
+HostHeapStats       host_heap_stats(void);
+void                host_resource_add(uint32_t resource_id, const uint8_t * data, size_t size);
+uint32_t            host_resource_reads(void);
+unsigned            host_layer_count(void);
+unsigned            host_layer_children(const Layer * layer);
+const char *        host_layer_render(Layer * layer);
+bool                host_click(ButtonId button);
+
+#define malloc(size)        host_malloc(size)
+#define calloc(count, size) host_calloc(count, size)
+#define realloc(ptr, size)  host_realloc(ptr, size)
+#define free(ptr)           host_free(ptr)
@@ -0,0 +1,628 @@
+/** Host Pebble Shim
+ */
+#include "pebble.h"
+
+// The arena must not allocate from itself, the resource table uses the host heap
+#undef malloc
+#undef calloc
+#undef realloc
+#undef free
+
+/*
+ *  Heap arena
+ */
+
+// Block header, payloads are kept 16 byte aligned
+typedef struct _host_block_ {
+    size_t size;                // Payload bytes following the header
+    size_t used;
+} HostBlock;
+
+#define HOST_ALIGN(x)       (((x) + 15) & ~(size_t)15)
+#define HOST_HEADER         HOST_ALIGN(sizeof(HostBlock))
+#define HOST_MIN_SPLIT      (HOST_HEADER + 16)
+
+static union {
+    uint8_t bytes[HOST_HEAP_SIZE];
+    long double align;
+} s_heap;
+static bool s_heap_ready = false;
+static HostHeapStats s_heap_stats;
+
+static HostBlock * host_block_next(HostBlock * block) {
+    uint8_t * next = (uint8_t*)block + HOST_HEADER + block->size;
+    return (next < s_heap.bytes + HOST_HEAP_SIZE ? (HostBlock*)next : NULL);
+}
+
+static void host_heap_init(void) {
+    if(s_heap_ready)
+        return;
+
+    HostBlock * block = (HostBlock*)s_heap.bytes;
+    block->size = HOST_HEAP_SIZE - HOST_HEADER;
+    block->used = 0;
+    s_heap_ready = true;
+}
+
+// Merges the free blocks following @block into it
+static void host_block_merge(HostBlock * block) {
+    for(HostBlock * next = host_block_next(block); next && !next->used; next = host_block_next(block)) {
+        block->size += HOST_HEADER + next->size;
+    }
+}
+
+void * host_malloc(size_t size) {
+    host_heap_init();
+    size_t need = HOST_ALIGN(size > 0 ? size : 1);
+
+    // First fit, as the watch allocator
+    for(HostBlock * block = (HostBlock*)s_heap.bytes; block; block = host_block_next(block)) {
+        if(block->used)
+            continue;
+        host_block_merge(block);
+        if(block->size < need)
+            continue;
+
+        if(block->size - need >= HOST_MIN_SPLIT) {
+            HostBlock * rest = (HostBlock*)((uint8_t*)block + HOST_HEADER + need);
+            rest->size = block->size - need - HOST_HEADER;
+            rest->used = 0;
+            block->size = need;
+        }
+        block->used = 1;
+        s_heap_stats.allocations++;
+        s_heap_stats.used += block->size;
+        if(s_heap_stats.used > s_heap_stats.peak)
+            s_heap_stats.peak = s_heap_stats.used;
+        return (uint8_t*)block + HOST_HEADER;
+    }
+
+    s_heap_stats.failures++;
+    return NULL;
+}
+
+void * host_calloc(size_t count, size_t size) {
+    void * ptr = host_malloc(count * size);
+    if(ptr)
+        memset(ptr, 0, count * size);
+    return ptr;
+}
+
+void host_free(void * ptr) {
+    if(!ptr)
+        return;
+
+    HostBlock * block = (HostBlock*)((uint8_t*)ptr - HOST_HEADER);
+    block->used = 0;
+    s_heap_stats.frees++;
+    s_heap_stats.used -= block->size;
+}
+
+void * host_realloc(void * ptr, size_t size) {
+    if(!ptr)
+        return host_malloc(size);
+
+    HostBlock * block = (HostBlock*)((uint8_t*)ptr - HOST_HEADER);
+    void * moved = host_malloc(size);
+    if(!moved)
+        return NULL;
+    memcpy(moved, ptr, (block->size < size ? block->size : size));
+    host_free(ptr);
+    return moved;
+}
+
+HostHeapStats host_heap_stats(void) {
+    host_heap_init();
+
+    HostHeapStats stats = s_heap_stats;
+    stats.free = 0;
+    stats.largest_free = 0;
+    stats.free_blocks = 0;
+    for(HostBlock * block = (HostBlock*)s_heap.bytes; block; block = host_block_next(block)) {
+        if(block->used)
+            continue;
+        host_block_merge(block);
+        stats.free += block->size;
+        stats.free_blocks++;
+        if(block->size > stats.largest_free)
+            stats.largest_free = block->size;
+    }
+    return stats;
+}
+
+size_t heap_bytes_free(void) {
+    return host_heap_stats().free;
+}
+
+size_t heap_bytes_used(void) {
+    return s_heap_stats.used;
+}
+
+/*
+ *  Layers
+ */
+
+struct Layer {
+    GRect frame;
+    GRect bounds;
+    Layer * parent;
+    Layer * first_child;
+    Layer * next_sibling;
+    Window * window;            // Set on Window root layers only
+    LayerUpdateProc update_proc;
+    bool hidden;
+    uint8_t * data;
+};
+
+struct Window {
+    Layer * root;
+};
+
+static unsigned s_layer_count = 0;
+
+Layer * layer_create_with_data(GRect frame, size_t data_size) {
+    Layer * layer = (Layer*)host_calloc(1, sizeof(Layer) + data_size);
+    if(!layer)
+        return NULL;
+
+    s_layer_count++;
+    layer->frame = frame;
+    layer->bounds = GRect(0, 0, frame.size.w, frame.size.h);
+    layer->data = (data_size > 0 ? (uint8_t*)(layer + 1) : NULL);
+    return layer;
+}
+
+Layer * layer_create(GRect frame) {
+    return layer_create_with_data(frame, 0);
+}
+
+void layer_destroy(Layer * layer) {
+    if(!layer)
+        return;
+
+    layer_remove_from_parent(layer);
+    layer_remove_child_layers(layer);
+    s_layer_count--;
+    host_free(layer);
+}
+
+void * layer_get_data(const Layer * layer) {
+    return layer->data;
+}
+
+GRect layer_get_frame(const Layer * layer) {
+    return layer->frame;
+}
+
+void layer_set_frame(Layer * layer, GRect frame) {
+    // Bounds follow the frame size while they still cover the whole frame, as on the watch
+    if(layer->bounds.origin.x == 0 && layer->bounds.origin.y == 0 &&
+       layer->bounds.size.w == layer->frame.size.w && layer->bounds.size.h == layer->frame.size.h)
+        layer->bounds.size = frame.size;
+    layer->frame = frame;
+}
+
+GRect layer_get_bounds(const Layer * layer) {
+    return layer->bounds;
+}
+
+void layer_set_bounds(Layer * layer, GRect bounds) {
+    layer->bounds = bounds;
+}
+
+void layer_add_child(Layer * parent, Layer * child) {
+    layer_remove_from_parent(child);
+    child->parent = parent;
+    Layer ** link = &parent->first_child;
+    while(*link) {
+        link = &(*link)->next_sibling;
+    }
+    *link = child;
+}
+
+void layer_remove_from_parent(Layer * layer) {
+    if(!layer->parent)
+        return;
+
+    Layer ** link = &layer->parent->first_child;
+    while(*link && *link != layer) {
+        link = &(*link)->next_sibling;
+    }
+    if(*link)
+        *link = layer->next_sibling;
+    layer->parent = NULL;
+    layer->next_sibling = NULL;
+}
+
+void layer_remove_child_layers(Layer * layer) {
+    while(layer->first_child) {
+        layer_remove_from_parent(layer->first_child);
+    }
+}
+
+void layer_mark_dirty(Layer * layer) {
+    (void)layer;
+}
+
+Window * layer_get_window(const Layer * layer) {
+    while(layer->parent) {
+        layer = layer->parent;
+    }
+    return layer->window;
+}
+
+void layer_set_update_proc(Layer * layer, LayerUpdateProc update_proc) {
+    layer->update_proc = update_proc;
+}
+
+void layer_set_hidden(Layer * layer, bool hidden) {
+    layer->hidden = hidden;
+}
+
+bool layer_get_hidden(const Layer * layer) {
+    return layer->hidden;
+}
+
+unsigned host_layer_count(void) {
+    return s_layer_count;
+}
+
+unsigned host_layer_children(const Layer * layer) {
+    unsigned count = 0;
+    for(Layer * child = layer->first_child; child; child = child->next_sibling) {
+        count++;
+    }
+    return count;
+}
+
+Window * window_create(void) {
+    Window * window = (Window*)host_calloc(1, sizeof(Window));
+    if(!window)
+        return NULL;
+
+    window->root = layer_create(GRect(0, 0, 144, 168));
+    if(!window->root) {
+        host_free(window);
+        return NULL;
+    }
+    window->root->window = window;
+    return window;
+}
+
+void window_destroy(Window * window) {
+    if(!window)
+        return;
+
+    layer_destroy(window->root);
+    host_free(window);
+}
+
+Layer * window_get_root_layer(const Window * window) {
+    return window->root;
+}
+
+// Single click handlers of the last provider set on any Window, indexed by ButtonId
+static ClickHandler s_click_handlers[BUTTON_ID_DOWN + 1];
+static void * s_click_context = NULL;
+
+void window_set_click_config_provider_with_context(Window * window, ClickConfigProvider provider, void * context) {
+    (void)window;
+    memset(s_click_handlers, 0, sizeof(s_click_handlers));
+    s_click_context = context;
+    if(provider)
+        provider(context);
+}
+
+void window_single_click_subscribe(ButtonId button, ClickHandler handler) {
+    s_click_handlers[button] = handler;
+}
+
+bool host_click(ButtonId button) {
+    if(!s_click_handlers[button])
+        return false;
+
+    s_click_handlers[button](NULL, s_click_context);
+    return true;
+}
+
+/*
+ *  ScrollLayer and InverterLayer
+ */
+
+struct ScrollLayer {
+    Layer * layer;
+    Layer * content;
+    GSize content_size;
+};
+
+struct InverterLayer {
+    Layer * layer;
+};
+
+ScrollLayer * scroll_layer_create(GRect frame) {
+    ScrollLayer * scroll = (ScrollLayer*)host_calloc(1, sizeof(ScrollLayer));
+    if(!scroll)
+        return NULL;
+
+    scroll->layer = layer_create(frame);
+    scroll->content = layer_create(GRect(0, 0, frame.size.w, frame.size.h));
+    if(!scroll->layer || !scroll->content) {
+        scroll_layer_destroy(scroll);
+        return NULL;
+    }
+    layer_add_child(scroll->layer, scroll->content);
+    return scroll;
+}
+
+void scroll_layer_destroy(ScrollLayer * layer) {
+    if(!layer)
+        return;
+
+    layer_destroy(layer->content);
+    layer_destroy(layer->layer);
+    host_free(layer);
+}
+
+Layer * scroll_layer_get_layer(const ScrollLayer * layer) {
+    return layer->layer;
+}
+
+void scroll_layer_add_child(ScrollLayer * layer, Layer * child) {
+    layer_add_child(layer->content, child);
+}
+
+void scroll_layer_set_content_size(ScrollLayer * layer, GSize size) {
+    layer->content_size = size;
+}
+
+GSize scroll_layer_get_content_size(const ScrollLayer * layer) {
+    return layer->content_size;
+}
+
+void scroll_layer_set_content_offset(ScrollLayer * layer, GPoint offset, bool animated) {
+    (void)animated;
+    layer->content->frame.origin = offset;
+}
+
+GPoint scroll_layer_get_content_offset(ScrollLayer * layer) {
+    return layer->content->frame.origin;
+}
+
+void scroll_layer_set_context(ScrollLayer * layer, void * context) {
+    (void)layer;
+    (void)context;
+}
+
+void scroll_layer_set_callbacks(ScrollLayer * layer, ScrollLayerCallbacks callbacks) {
+    (void)layer;
+    (void)callbacks;
+}
+
+InverterLayer * inverter_layer_create(GRect frame) {
+    InverterLayer * inverter = (InverterLayer*)host_calloc(1, sizeof(InverterLayer));
+    if(!inverter)
+        return NULL;
+
+    inverter->layer = layer_create(frame);
+    if(!inverter->layer) {
+        host_free(inverter);
+        return NULL;
+    }
+    return inverter;
+}
+
+void inverter_layer_destroy(InverterLayer * layer) {
+    if(!layer)
+        return;
+
+    layer_destroy(layer->layer);
+    host_free(layer);
+}
+
+Layer * inverter_layer_get_layer(InverterLayer * layer) {
+    return layer->layer;
+}
+
+/*
+ *  Animation, scheduled animations finish straight away
+ */
+
+struct PropertyAnimation {
+    Layer * layer;
+    GRect to;
+    AnimationHandlers handlers;
+    void * context;
+};
+
+PropertyAnimation * property_animation_create_layer_frame(Layer * layer, GRect * from, GRect * to) {
+    PropertyAnimation * animation = (PropertyAnimation*)host_calloc(1, sizeof(PropertyAnimation));
+    if(!animation)
+        return NULL;
+
+    animation->layer = layer;
+    animation->to = (to ? *to : layer->frame);
+    if(from)
+        layer_set_frame(layer, *from);
+    return animation;
+}
+
+void property_animation_destroy(PropertyAnimation * animation) {
+    host_free(animation);
+}
+
+void animation_set_duration(Animation * animation, uint32_t duration) {
+    (void)animation;
+    (void)duration;
+}
+
+void animation_set_delay(Animation * animation, uint32_t delay) {
+    (void)animation;
+    (void)delay;
+}
+
+void animation_set_handlers(Animation * animation, AnimationHandlers handlers, void * context) {
+    PropertyAnimation * property = (PropertyAnimation*)animation;
+    property->handlers = handlers;
+    property->context = context;
+}
+
+void animation_schedule(Animation * animation) {
+    PropertyAnimation * property = (PropertyAnimation*)animation;
+    layer_set_frame(property->layer, property->to);
+    if(property->handlers.stopped)
+        property->handlers.stopped(animation, true, property->context);
+}
+
+/*
+ *  Graphics
+ */
+
+struct GBitmap {
+    GRect bounds;
+};
+
+GFont fonts_get_system_font(const char * key) {
+    return (GFont)key;
+}
+
+void graphics_context_set_text_color(GContext * ctx, GColor color) {
+    (void)ctx;
+    (void)color;
+}
+
+struct GContext {
+    const char * text;          // First text drawn since host_layer_render()
+};
+
+static GContext s_context;
+
+void graphics_draw_text(GContext * ctx, const char * text, GFont font, GRect box, GTextOverflowMode mode, GTextAlignment alignment, GTextLayoutCacheRef layout) {
+    (void)font; (void)box; (void)mode; (void)alignment; (void)layout;
+    if(!ctx->text)
+        ctx->text = text;
+}
+
+const char * host_layer_render(Layer * layer) {
+    s_context.text = NULL;
+    if(layer->update_proc && !layer->hidden)
+        layer->update_proc(layer, &s_context);
+    return s_context.text;
+}
+
+GSize graphics_text_layout_get_content_size(const char * text, GFont font, GRect box, GTextOverflowMode mode, GTextAlignment alignment) {
+    (void)font; (void)mode; (void)alignment;
+    int length = (int)strlen(text);
+    int width = length * 6;
+    int height = ((length + 11) / 12) * 14;
+    return GSize((width < box.size.w ? width : box.size.w), (height < box.size.h ? height : box.size.h));
+}
+
+void graphics_draw_bitmap_in_rect(GContext * ctx, const GBitmap * bitmap, GRect rect) {
+    (void)ctx; (void)bitmap; (void)rect;
+}
+
+/*
+ *  Resources, registered by the benchmarks
+ */
+
+struct ResHandle_ {
+    uint32_t id;
+    const uint8_t * data;
+    size_t size;
+};
+
+static struct ResHandle_ * s_resources = NULL;
+static unsigned s_resource_count = 0;
+static uint32_t s_resource_reads = 0;
+
+void host_resource_add(uint32_t resource_id, const uint8_t * data, size_t size) {
+    s_resources = (struct ResHandle_*)realloc(s_resources, (s_resource_count + 1) * sizeof(struct ResHandle_));
+    s_resources[s_resource_count++] = (struct ResHandle_) { resource_id, data, size };
+}
+
+uint32_t host_resource_reads(void) {
+    return s_resource_reads;
+}
+
+ResHandle resource_get_handle(uint32_t resource_id) {
+    for(unsigned i = 0; i < s_resource_count; ++i) {
+        if(s_resources[i].id == resource_id)
+            return &s_resources[i];
+    }
+    return NULL;
+}
+
+size_t resource_size(ResHandle handle) {
+    return (handle ? handle->size : 0);
+}
+
+size_t resource_load_byte_range(ResHandle handle, uint32_t start_offset, uint8_t * buffer, size_t num_bytes) {
+    if(!handle || start_offset >= handle->size)
+        return 0;
+
+    s_resource_reads++;
+    if(num_bytes > handle->size - start_offset)
+        num_bytes = handle->size - start_offset;
+    memcpy(buffer, handle->data + start_offset, num_bytes);
+    return num_bytes;
+}
+
+size_t resource_load(ResHandle handle, uint8_t * buffer, size_t max_length) {
+    return resource_load_byte_range(handle, 0, buffer, max_length);
+}
+
+// Icons are 24x24 and hold as many bytes of heap as their resource
+GBitmap * gbitmap_create_with_resource(uint32_t resource_id) {
+    ResHandle handle = resource_get_handle(resource_id);
+    if(!handle)
+        return NULL;
+
+    GBitmap * bitmap = (GBitmap*)host_calloc(1, sizeof(GBitmap) + handle->size);
+    if(bitmap)
+        bitmap->bounds = GRect(0, 0, 24, 24);
+    return bitmap;
+}
+
+void gbitmap_destroy(GBitmap * bitmap) {
+    host_free(bitmap);
+}
+
+GRect gbitmap_get_bounds(const GBitmap * bitmap) {
+    return bitmap->bounds;
+}
+
+/*
+ *  Services
+ */
+
+void vibes_short_pulse(void) {
+}
+
+int accel_data_service_subscribe(uint32_t samples_per_update, AccelDataHandler handler) {
+    (void)samples_per_update;
+    (void)handler;
+    return 0;
+}
+
+void accel_data_service_unsubscribe(void) {
+}
+
+int accel_service_set_sampling_rate(AccelSamplingRate rate) {
+    (void)rate;
+    return 0;
+}
+
+void battery_state_service_subscribe(BatteryStateHandler handler) {
+    (void)handler;
+}
+
+void battery_state_service_unsubscribe(void) {
+}
+
+BatteryChargeState battery_state_service_peek(void) {
+    return (BatteryChargeState) { 100, false, false };
+}
+
+bool gpoint_equal(const GPoint * a, const GPoint * b) {
+    return (a->x == b->x && a->y == b->y);
+}
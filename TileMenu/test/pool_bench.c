@@ -0,0 +1,98 @@
+/** Pool Bench
+ *
+ *  Pushes and pops a child TileMenu onto a root TileMenu for 100 cycles,
+ *  as an app drilling in and out of a submenu would, and reports the heap
+ *  allocations made and how fragmented the heap is left. Runs against the
+ *  host shim in pebble.h so the heap figures come from its fixed-size arena.
+ *
+ *  Every cycle also keeps a small app allocation, like a history entry,
+ *  so the heap is shared with objects TileMenu does not own.
+ *
+ *  Usage: pool_bench [-p]
+ *      -p  Enables the TileMenuPool
+ */
+#include <stdio.h>
+#include "tile_menu.h"
+
+#define POOL_BENCH_CYCLES       100
+#define POOL_BENCH_ROOT_TILES   12
+#define POOL_BENCH_HISTORY_SIZE 24
+
+// Child sizes are varied like the submenus of an app, all with the same tiles per row
+static const unsigned s_child_tiles[] = { 8, 20, 14, 32, 6 };
+
+static const char * s_titles[] = { "Mail", "Music", "Maps", "Timer", "Alarm", "Notes" };
+
+static bool pool_bench_label(TileMenu * menu, unsigned tiles) {
+    GFont font = fonts_get_system_font("GOTHIC_14");
+    for(unsigned i = 0; i < tiles; ++i) {
+        Layer * tile = (i == 0 ? tile_menu_get_curr(menu) : tile_menu_get_next(menu));
+        if(!tile_menu_set_tile_label(menu, tile, s_titles[i % 6], NULL, font))
+            return false;
+    }
+    return true;
+}
+
+int main(int argc, char ** argv) {
+    bool pooled = (argc > 1 && strcmp(argv[1], "-p") == 0);
+    if(pooled)
+        tile_menu_pool_init();
+
+    Window * window = window_create();
+    GRect frame = layer_get_bounds(window_get_root_layer(window));
+    TileMenu * root = tile_menu_create(frame, window, POOL_BENCH_ROOT_TILES, 3, 2);
+    if(!root || !pool_bench_label(root, POOL_BENCH_ROOT_TILES))
+        return 1;
+    layer_add_child(window_get_root_layer(window), tile_menu_get_layer(root));
+    tile_menu_draw(root);
+
+    void * history[POOL_BENCH_CYCLES];
+    HostHeapStats start = host_heap_stats();
+    for(unsigned cycle = 0; cycle < POOL_BENCH_CYCLES; ++cycle) {
+        unsigned tiles = s_child_tiles[cycle % (sizeof(s_child_tiles) / sizeof(s_child_tiles[0]))];
+        TileMenu * child = tile_menu_create(frame, window, tiles, 3, 2);
+        if(!child || !pool_bench_label(child, tiles) || !tile_menu_push(root, child)) {
+            fprintf(stderr, "cycle %u: push failed\n", cycle);
+            return 1;
+        }
+        tile_menu_draw(child);
+        tile_menu_set_selected_rows(child, 2);
+        history[cycle] = malloc(POOL_BENCH_HISTORY_SIZE);
+        if(tile_menu_pop(child) != root) {
+            fprintf(stderr, "cycle %u: pop failed\n", cycle);
+            return 1;
+        }
+    }
+    HostHeapStats end = host_heap_stats();
+    TileMenuPoolStats pool = tile_menu_pool_get_stats();
+
+    printf("pool %s, %d push/pop cycles\n", (pooled ? "enabled" : "disabled"), POOL_BENCH_CYCLES);
+    printf("  heap allocations   %u, %.1f per cycle\n", end.allocations - start.allocations,
+           (double)(end.allocations - start.allocations) / POOL_BENCH_CYCLES);
+    printf("  pool allocations   %u layers and selectors, %u nodes\n", pool.allocations, pool.node_allocations);
+    printf("  pool reuses        %u layers and selectors, %u nodes\n", pool.reuses, pool.node_reuses);
+    printf("  pool spares        %u tiles, %u rows, %u selectors, %u nodes\n",
+           pool.spare_tiles, pool.spare_rows, pool.spare_selectors, pool.spare_nodes);
+    printf("  heap used          %zu B (peak %zu B)\n", end.used, end.peak);
+    printf("  free blocks        %u, largest %zu of %zu B free, %.1f%% fragmented\n",
+           end.free_blocks, end.largest_free, end.free,
+           (end.free > 0 ? 100.0 * (end.free - end.largest_free) / end.free : 0.0));
+
+    // Draining must hand every spare object, list nodes included, back to the heap
+    bool passed = true;
+    if(pooled) {
+        tile_menu_pool_deinit();
+        pool = tile_menu_pool_get_stats();
+        passed = (pool.spare_tiles == 0 && pool.spare_rows == 0 && pool.spare_selectors == 0 && pool.spare_nodes == 0);
+        printf("  after deinit       %zu B used, %u nodes spare %s\n", host_heap_stats().used, pool.spare_nodes,
+               (passed ? "PASS" : "FAIL"));
+    }
+
+    for(unsigned cycle = 0; cycle < POOL_BENCH_CYCLES; ++cycle) {
+        free(history[cycle]);
+    }
+    layer_remove_from_parent(tile_menu_get_layer(root));
+    tile_menu_destroy(root);
+    window_destroy(window);
+    return (passed ? 0 : 1);
+}
@@ -0,0 +1,57 @@
+/** TileCatalog
+ */
+#include "tile_catalog.h"
+
+struct _tile_catalog_ {
+    ResHandle handle;
+    uint16_t count;
+    uint16_t record_size;
+};
+
+TileCatalog * tile_catalog_create(uint32_t resource_id) {
+    ResHandle handle = resource_get_handle(resource_id);
+    if(!handle || resource_size(handle) < TILE_CATALOG_HEADER_SIZE)
+        return NULL;
+
+    uint8_t header[TILE_CATALOG_HEADER_SIZE];
+    if(resource_load_byte_range(handle, 0, header, TILE_CATALOG_HEADER_SIZE) != TILE_CATALOG_HEADER_SIZE ||
+       memcmp(header, TILE_CATALOG_MAGIC, 4) != 0)
+        return NULL;
+
+    uint16_t count = header[4] | (header[5] << 8);
+    uint16_t record_size = header[6] | (header[7] << 8);
+    if(record_size < sizeof(TileCatalogRecord) ||
+       resource_size(handle) < TILE_CATALOG_HEADER_SIZE + ((size_t)count * record_size))
+        return NULL;
+
+    TileCatalog * catalog = (TileCatalog*)malloc(sizeof(TileCatalog));
+    if(!catalog)
+        return NULL;
+
+    catalog->handle = handle;
+    catalog->count = count;
+    catalog->record_size = record_size;
+    return catalog;
+}
+
+void tile_catalog_destroy(TileCatalog * catalog) {
+    free(catalog);
+}
+
+uint16_t tile_catalog_get_count(TileCatalog * catalog) {
+    return (catalog ? catalog->count : 0);
+}
+
+bool tile_catalog_read(TileCatalog * catalog, uint16_t index, TileCatalogRecord * record) {
+    if(!catalog || !record || index >= catalog->count)
+        return false;
+
+    // Only the leading fields this version knows about are read from larger records
+    uint32_t offset = TILE_CATALOG_HEADER_SIZE + ((uint32_t)index * catalog->record_size);
+    if(resource_load_byte_range(catalog->handle, offset, (uint8_t*)record, sizeof(TileCatalogRecord)) != sizeof(TileCatalogRecord))
+        return false;
+
+    record->title[TILE_CATALOG_TITLE_LENGTH - 1] = '\0';
+    record->subtitle[TILE_CATALOG_SUBTITLE_LENGTH - 1] = '\0';
+    return true;
+}
@@ -0,0 +1,58 @@
+/** TileCatalog
+ */
+#include <pebble.h>
+
+#define TILE_CATALOG_MAGIC              "TCAT"
+#define TILE_CATALOG_HEADER_SIZE        8
+#define TILE_CATALOG_TITLE_LENGTH       24
+#define TILE_CATALOG_SUBTITLE_LENGTH    24
+
+/** TILE CATALOG FORMAT **
+ *
+ *  @brief: A @TileCatalog is a raw Pebble resource packed by
+ *          tools/tile_catalog_pack.py, all values little-endian:
+ *
+ *          Header (TILE_CATALOG_HEADER_SIZE bytes)
+ *              char     magic[4]       TILE_CATALOG_MAGIC
+ *              uint16_t count          Number of records
+ *              uint16_t record_size    Size of each record, at least sizeof(TileCatalogRecord)
+ *
+ *          Records (count * record_size bytes)
+ *              uint32_t icon_id        Icon resource ID, 0 if none
+ *              uint32_t action         Application defined action code
+ *              char     title[TILE_CATALOG_TITLE_LENGTH]
+ *              char     subtitle[TILE_CATALOG_SUBTITLE_LENGTH]
+ *
+ *          Strings are NUL padded, an empty subtitle means none. Records
+ *          are fixed-size so any one of them can be read on its own with
+ *          resource_load_byte_range() without touching the rest.
+ */
+typedef struct _tile_catalog_record_ {
+    uint32_t icon_id;
+    uint32_t action;
+    char title[TILE_CATALOG_TITLE_LENGTH];
+    char subtitle[TILE_CATALOG_SUBTITLE_LENGTH];
+} TileCatalogRecord;
+
+typedef struct _tile_catalog_ TileCatalog;
+
+/** Create / Destroy **
+ *
+ *  @brief: Opens the catalog resource @resource_id, only its header is read.
+ *  @returns: The @TileCatalog, NULL if out of memory or not a valid catalog.
+ */
+TileCatalog *   tile_catalog_create(uint32_t resource_id);
+void            tile_catalog_destroy(TileCatalog * catalog);
+
+/** Count **
+ *
+ *  @returns: The number of records in the @TileCatalog, 0 if NULL.
+ */
+uint16_t        tile_catalog_get_count(TileCatalog * catalog);
+
+/** Read **
+ *
+ *  @brief: Reads the single record at @index into @record.
+ *  @returns: @true on success, @false if @index is out of range or the read failed.
+ */
+bool            tile_catalog_read(TileCatalog * catalog, uint16_t index, TileCatalogRecord * record);
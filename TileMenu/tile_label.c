@@ -0,0 +1,112 @@
+/** TileLabel
+ */
+#include "tile_label.h"
+
+static void tile_label_layout(TileLabel * label, GSize size);
+
+static void tile_label_layout(TileLabel * label, GSize size) {
+    GSize icon = (label->icon_id != 0 ? label->icon_size : GSize(0, 0));
+    if(icon.w > size.w)
+        icon.w = size.w;
+    if(icon.h > size.h)
+        icon.h = size.h;
+
+    GRect box = GRect(TILE_LABEL_MARGIN, 0, size.w - (2 * TILE_LABEL_MARGIN), size.h - icon.h);
+    GSize title = GSize(0, 0);
+    GSize subtitle = GSize(0, 0);
+
+    if(label->font && label->title) {
+        title = graphics_text_layout_get_content_size(label->title, label->font, box,
+                                                      GTextOverflowModeWordWrap, GTextAlignmentCenter);
+    }
+    if(label->font && label->subtitle && title.h < box.size.h) {
+        box.size.h -= title.h;
+        subtitle = graphics_text_layout_get_content_size(label->subtitle, label->font, box,
+                                                         GTextOverflowModeWordWrap, GTextAlignmentCenter);
+    }
+
+    // Centres the icon, title and subtitle as a single block
+    int top = (size.h - icon.h - title.h - subtitle.h) / 2;
+    if(top < 0)
+        top = 0;
+
+    label->icon_frame = GRect((size.w - icon.w) / 2, top, icon.w, icon.h);
+    label->title_frame = GRect(box.origin.x, top + icon.h, box.size.w, title.h);
+    label->subtitle_frame = GRect(box.origin.x, top + icon.h + title.h, box.size.w, subtitle.h);
+    label->size = size;
+    label->valid = true;
+}
+
+TileLabel * tile_label_create(void) {
+    return (TileLabel*)calloc(1, sizeof(TileLabel));
+}
+
+void tile_label_destroy(TileLabel * label) {
+    free(label);
+}
+
+void tile_label_set(TileLabel * label, const char * title, const char * subtitle, GFont font) {
+    if(!label)
+        return;
+
+    label->title = title;
+    label->subtitle = subtitle;
+    label->font = font;
+    label->valid = false;
+}
+
+void tile_label_reserve_icon(TileLabel * label, uint32_t icon_id, GSize size) {
+    if(!label)
+        return;
+
+    if((label->icon_id != 0) != (icon_id != 0) || label->icon_size.w != size.w || label->icon_size.h != size.h)
+        label->valid = false;
+    label->icon_id = icon_id;
+    label->icon_size = size;
+}
+
+void tile_label_set_icon(TileLabel * label, GBitmap * icon) {
+    if(!label)
+        return;
+
+    label->icon = icon;
+}
+
+void tile_label_draw(TileLabel * label, GContext * ctx, GRect bounds) {
+    if(!label || !ctx)
+        return;
+
+    if(!label->valid || label->size.w != bounds.size.w || label->size.h != bounds.size.h)
+        tile_label_layout(label, bounds.size);
+
+    if(label->icon && label->icon_frame.size.h > 0) {
+        GSize icon = gbitmap_get_bounds(label->icon).size;
+        if(icon.w > label->icon_frame.size.w)
+            icon.w = label->icon_frame.size.w;
+        if(icon.h > label->icon_frame.size.h)
+            icon.h = label->icon_frame.size.h;
+        graphics_draw_bitmap_in_rect(ctx, label->icon,
+                                     GRect(bounds.origin.x + label->icon_frame.origin.x + (label->icon_frame.size.w - icon.w) / 2,
+                                           bounds.origin.y + label->icon_frame.origin.y + (label->icon_frame.size.h - icon.h) / 2,
+                                           icon.w,
+                                           icon.h));
+    }
+
+    graphics_context_set_text_color(ctx, TILE_LABEL_TEXT_COLOR);
+    if(label->font && label->title && label->title_frame.size.h > 0) {
+        graphics_draw_text(ctx, label->title, label->font,
+                           GRect(bounds.origin.x + label->title_frame.origin.x,
+                                 bounds.origin.y + label->title_frame.origin.y,
+                                 label->title_frame.size.w,
+                                 label->title_frame.size.h),
+                           GTextOverflowModeWordWrap, GTextAlignmentCenter, NULL);
+    }
+    if(label->font && label->subtitle && label->subtitle_frame.size.h > 0) {
+        graphics_draw_text(ctx, label->subtitle, label->font,
+                           GRect(bounds.origin.x + label->subtitle_frame.origin.x,
+                                 bounds.origin.y + label->subtitle_frame.origin.y,
+                                 label->subtitle_frame.size.w,
+                                 label->subtitle_frame.size.h),
+                           GTextOverflowModeWordWrap, GTextAlignmentCenter, NULL);
+    }
+}
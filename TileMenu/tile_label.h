@@ -0,0 +1,80 @@
+/** TileLabel
+ */
+#include <pebble.h>
+
+// Horizontal padding (px) between the tile edges and its text
+#define TILE_LABEL_MARGIN       2
+// Colour the title and subtitle are drawn in
+#define TILE_LABEL_TEXT_COLOR   GColorWhite
+
+/** @TileLabel **
+ *
+ *  @brief: An optional icon above a title and optional subtitle, drawn
+ *          centred in a tile. The text is measured once with
+ *          graphics_text_layout_get_content_size() and the resulting icon,
+ *          title and subtitle frames are kept, so redraws do not measure it
+ *          again. Only the frames are cached: graphics_draw_text() is passed
+ *          no layout cache, as the SDK gives apps no way to create one, so it
+ *          still lays the text out every time the tile is drawn.
+ *
+ *          The icon box is reserved from the icon size given with its
+ *          resource ID, so loading and releasing the bitmap as the tile
+ *          scrolls in and out of view never moves the text. The frames are
+ *          only measured again when the icon size, text, font or the size
+ *          of the tile changes.
+ *
+ *  N.B. Strings are NOT copied, like a TextLayer they must outlive the @TileLabel.
+ */
+typedef struct _tile_label_ {
+    const char * title;
+    const char * subtitle;
+    GFont font;
+    uint32_t icon_id;       // Resource ID of the icon, 0 if none
+    GBitmap * icon;         // Icon bitmap, NULL while not loaded
+    GSize icon_size;        // Box reserved for the icon whether or not it is loaded
+    GSize size;             // Tile size the cached frames were measured for
+    GRect icon_frame;
+    GRect title_frame;
+    GRect subtitle_frame;
+    bool valid;             // Cached frames match the text, font and icon size
+} TileLabel;
+
+/** Create / Destroy **
+ *
+ *  @brief: Creates an empty @TileLabel on the heap, NULL if out of memory.
+ */
+TileLabel *     tile_label_create(void);
+void            tile_label_destroy(TileLabel * label);
+
+/** Setter **
+ *
+ *  @brief: Sets the text and font of the @TileLabel and invalidates its
+ *          cached frames. @subtitle may be NULL.
+ */
+void            tile_label_set(TileLabel * label, const char * title, const char * subtitle, GFont font);
+
+/** Icon Reservation **
+ *
+ *  @brief: Sets the resource ID of the icon, 0 for none, and the @size of
+ *          the box reserved for it above the text. The cached frames are
+ *          only invalidated if the reserved box changes.
+ */
+void            tile_label_reserve_icon(TileLabel * label, uint32_t icon_id, GSize size);
+
+/** Icon Setter **
+ *
+ *  @brief: Sets the loaded @icon bitmap, or NULL to leave its box blank.
+ *          The frames are kept as the box is reserved by
+ *          tile_label_reserve_icon(), a bitmap of another size is centred
+ *          in the box and clipped to it.
+ *
+ *  N.B. The bitmap is NOT owned by the @TileLabel.
+ */
+void            tile_label_set_icon(TileLabel * label, GBitmap * icon);
+
+/** Draw **
+ *
+ *  @brief: Draws the @TileLabel into @bounds, measuring its frames first
+ *          only if they are invalid or @bounds has changed size.
+ */
+void            tile_label_draw(TileLabel * label, GContext * ctx, GRect bounds);
@@ -3,8 +3,13 @@
  */
 #include "tile_menu.h"
 #include "xordll.h"
+#include "flick.h"
+#include "tile_label.h"
+#include "icon_cache.h"
 
 #define DIVIDE_UP(x,y)    (1 + ((x - 1) / y))
+// Row index of a catalog container that has not been bound to a row yet
+#define TILE_MENU_ROW_UNBOUND   UINT16_MAX
     
 typedef struct _tile_menu_iterator_ {
     XORListIterator pointer;
@@ -15,11 +20,33 @@ typedef struct _tile_menu_iterator_ {
     bool   (*at_end)(XORListIterator*);
 } TileMenuIterator;
     
+typedef struct _tile_menu_catalog_slot_ {
+    TileCatalogRecord record;     // Record of the row the tile is bound to
+    TileLabel label;              // Label drawn from the strings in @record
+} TileMenuCatalogSlot;
+
 typedef struct _tile_menu_selector_ {
     InverterLayer * inverter;     // Inverted layer that acts as the visible selector
-    TileMenuIterator iterator;    // Iterator to the selected Tile
+    uint16_t index;               // Index of the selected tile
     GPoint offset;                // Static offset, necessary to avoid animation interupts
+    struct _tile_menu_selector_ * next;  // Next spare selector while in the TileMenuPool
 } TileMenuSelector;
+
+// Layer data of every tile
+typedef struct _tile_menu_tile_ {
+    Layer * next;                 // Next spare tile while in the TileMenuPool
+    TileLabel * label;            // Built-in renderer, NULL until first used
+    uint16_t index;               // Index of the tile in its TileMenu
+} TileMenuTile;
+
+// Layer data of every row container, its tiles are reached without walking the tile list
+typedef struct _tile_menu_row_ {
+    Layer * next;                 // Next spare row while in the TileMenuPool
+    uint16_t index;               // Row the container holds, TILE_MENU_ROW_UNBOUND if none
+    uint8_t columns;              // Capacity of @tiles
+    uint8_t count;                // Tiles in the row, only the END row can be short
+    Layer * tiles[];
+} TileMenuRow;
     
 struct _tile_menu_ {
     ScrollLayer * layer;
@@ -27,13 +54,54 @@ struct _tile_menu_ {
     TileMenuIterator iterator;
     TileMenuSelector * selector;
     TileMenuCallback content_changed_handler;
+    TileMenuMemoryTierCallback memory_tier_changed_handler;
+    TileMenuSelectCallback select_handler;
     void * context;
     GPoint ulhs, lrhs;
+    TileMenuMemoryTier tier;      // Memory tier chosen from the free heap
+    size_t reduced_threshold;     // Free heap below which the Reduced tier is used
+    size_t minimal_threshold;     // Free heap below which the Minimal tier is used
+    unsigned tiles_per_row;
+    FlickDetector * flick;        // Flick detector, only allocated while flick scrolling is enabled
+    TileMenuAnimationProfile profile;
+    ClickConfigProvider click_config_provider;  // Application provider, NULL for the default
+    TileMenu * parent;            // Level this TileMenu was pushed onto, if any
+    TileMenu * child;             // Level pushed onto this TileMenu, if any
+    TileMenu * live_next;         // Next live TileMenu, used to drop spare rows nobody can reuse
+    TileCatalog * catalog;        // Resource the tiles are loaded from, if any
+    TileMenuCatalogSlot * slots;  // Record and label of every virtual tile, tiles_per_row per container
+    GFont catalog_font;
+    int16_t * row_offsets;        // Prefix sums of the row heights, row_count + 1 entries
+    unsigned row_count;
+    Layer ** rows;                // Row container Layers, row @row is held by rows[@row % container_count]
+    unsigned container_count;     // row_count, or only enough to cover the view for a catalog
+    bool drawn;                   // Containers have been added to the ScrollLayer
+    uint16_t tile_count;
+    int16_t tile_width;
+    int16_t view_first;           // Rows currently holding their icons and records,
+    int16_t view_last;            // none while view_last < view_first
 };
 
+// The accelerometer service has no context so only one TileMenu can own it at a time
+static TileMenu * s_flick_menu = NULL;
+// Battery state is app-wide so a single subscription is shared by all TileMenus using the Auto profile
+static TileMenuAnimationProfile s_battery_profile = TileMenuAnimationProfileFull;
+static unsigned s_battery_subscribers = 0;
+// Objects released by destroyed TileMenus, kept for reuse while the TileMenuPool is enabled
+static bool s_pool_enabled = false;
+static bool s_pool_retaining = true;             // Cleared while any TileMenu is in the Minimal tier
+static unsigned s_pool_minimal_menus = 0;        // Live TileMenus in the Minimal tier
+static Layer * s_pool_tiles = NULL;              // Spare tiles, linked through their layer data
+static Layer * s_pool_rows = NULL;               // Spare row containers, linked through their layer data
+static TileMenuSelector * s_pool_selectors = NULL;
+static TileMenuPoolStats s_pool_stats;
+static TileMenu * s_live_menus = NULL;           // Every TileMenu not yet destroyed, linked through live_next
+
 void tile_menu_iterator_init(TileMenu * menu, TileMenuIterator * itr, bool forward);
 
-void tile_menu_selector_create(TileMenu * menu);
+void tile_menu_memory_update(TileMenu * menu);
+
+bool tile_menu_selector_create(TileMenu * menu);
 void tile_menu_selector_destroy(TileMenuSelector * selector);
 void tile_menu_selector_set(TileMenu * menu, TileMenuSelector * selector, Layer * parent, GRect from, GRect to);
 
@@ -43,6 +111,36 @@ static void tile_menu_click_config_provider(void *context);
 static void tile_menu_up_click_handler(ClickRecognizerRef recognizer, void *context);
 static void tile_menu_down_click_handler(ClickRecognizerRef recognizer, void *context);
 static void tile_menu_select_click_handler(ClickRecognizerRef recognizer, void *context);
+static void tile_menu_back_click_handler(ClickRecognizerRef recognizer, void *context);
+static void tile_menu_click_config_apply(TileMenu * menu);
+
+static void tile_menu_pool_drain(void);
+static void tile_menu_pool_retention_update(void);
+static void tile_menu_pool_prune_rows(void);
+static Layer * tile_menu_tile_create(GRect bounds, uint16_t index);
+static void tile_menu_tile_destroy(Layer * tile);
+static Layer * tile_menu_row_create(GRect frame, uint8_t columns);
+static void tile_menu_row_destroy(Layer * row);
+static bool tile_menu_content_fits(int32_t height);
+static bool tile_menu_tile_editable(TileMenu * menu, Layer * tile);
+static GRect tile_menu_tile_frame(TileMenu * menu, uint16_t index);
+static Layer * tile_menu_tile_at(TileMenu * menu, uint16_t index);
+static void tile_menu_row_layout(TileMenu * menu, unsigned row, bool resize);
+static TileLabel * tile_menu_tile_label(Layer * tile);
+static void tile_menu_label_update_proc(Layer * layer, GContext * ctx);
+static void tile_menu_rows_in_view(TileMenu * menu, int * first, int * last);
+static void tile_menu_row_update(TileMenu * menu, unsigned row, bool visible);
+static void tile_menu_tile_icon_update(TileMenu * menu, Layer * tile, bool visible);
+static bool tile_menu_container_create(TileMenu * menu, unsigned container);
+static void tile_menu_row_bind(TileMenu * menu, unsigned row);
+static void tile_menu_row_unbind(TileMenu * menu, unsigned container);
+static bool tile_menu_catalog_reserve(TileMenu * menu, int16_t height);
+static TileMenu * tile_menu_create_rows(GRect frame, Window * window, unsigned tiles, unsigned tiles_per_view, unsigned tiles_per_row, TileCatalog * catalog, GFont font);
+static void tile_menu_tiles_update(TileMenu * menu);
+static void tile_menu_selector_move(TileMenu * menu, uint16_t index);
+
+static void tile_menu_accel_data_handler(AccelData * data, uint32_t num_samples);
+static void tile_menu_battery_state_handler(BatteryChargeState charge);
 
 static void tile_menu_content_offset_changed_handler(ScrollLayer * layer, void * context) {
     //...
@@ -52,6 +150,8 @@ static void tile_menu_click_config_provider(void *context) {
     window_single_click_subscribe(BUTTON_ID_UP, tile_menu_up_click_handler);
     window_single_click_subscribe(BUTTON_ID_DOWN, tile_menu_down_click_handler);
     window_single_click_subscribe(BUTTON_ID_SELECT, tile_menu_select_click_handler);
+    if(((TileMenu*)context)->parent)
+        window_single_click_subscribe(BUTTON_ID_BACK, tile_menu_back_click_handler);
 }
 
 static void tile_menu_up_click_handler(ClickRecognizerRef recognizer, void *context) {
@@ -63,7 +163,439 @@ static void tile_menu_down_click_handler(ClickRecognizerRef recognizer, void *co
 }
 
 static void tile_menu_select_click_handler(ClickRecognizerRef recognizer, void *context) {
+    TileMenu * menu = (TileMenu*)context;
     vibes_short_pulse();
+    if(menu->select_handler && menu->selector)
+        menu->select_handler(menu, menu->selector->index, menu->context);
+}
+
+static void tile_menu_back_click_handler(ClickRecognizerRef recognizer, void *context) {
+    tile_menu_pop((TileMenu*)context);
+}
+
+static void tile_menu_click_config_apply(TileMenu * menu) {
+    Window * window = tile_menu_get_window(menu);
+    if(!window)
+        return;
+
+    if(menu->click_config_provider)
+        window_set_click_config_provider_with_context(window, menu->click_config_provider, menu->context);
+    else
+        window_set_click_config_provider_with_context(window, tile_menu_click_config_provider, (void*)menu);
+}
+
+static void tile_menu_pool_drain(void) {
+    while(s_pool_tiles) {
+        Layer * tile = s_pool_tiles;
+        s_pool_tiles = ((TileMenuTile*)layer_get_data(tile))->next;
+        layer_destroy(tile);
+    }
+    while(s_pool_rows) {
+        Layer * row = s_pool_rows;
+        s_pool_rows = ((TileMenuRow*)layer_get_data(row))->next;
+        layer_destroy(row);
+    }
+    while(s_pool_selectors) {
+        TileMenuSelector * selector = s_pool_selectors;
+        s_pool_selectors = selector->next;
+        inverter_layer_destroy(selector->inverter);
+        free(selector);
+    }
+    s_pool_stats.spare_tiles = 0;
+    s_pool_stats.spare_rows = 0;
+    s_pool_stats.spare_selectors = 0;
+    xorlist_drain_spare_nodes();
+}
+
+// The pool keeps nothing, list nodes included, while any TileMenu is short enough of heap to be in the Minimal tier
+static void tile_menu_pool_retention_update(void) {
+    s_pool_retaining = (s_pool_minimal_menus == 0);
+    if(s_pool_enabled)
+        xorlist_set_node_recycling(s_pool_retaining);
+    if(!s_pool_retaining)
+        tile_menu_pool_drain();
+}
+
+// Spare rows are only reused by the same tiles_per_row so widths no live TileMenu has would be kept forever
+static void tile_menu_pool_prune_rows(void) {
+    Layer ** link = &s_pool_rows;
+    while(*link) {
+        TileMenuRow * data = (TileMenuRow*)layer_get_data(*link);
+        TileMenu * menu = s_live_menus;
+        while(menu && menu->tiles_per_row != data->columns) {
+            menu = menu->live_next;
+        }
+        if(menu) {
+            link = &data->next;
+            continue;
+        }
+
+        Layer * row = *link;
+        *link = data->next;
+        layer_destroy(row);
+        s_pool_stats.spare_rows--;
+    }
+}
+
+static Layer * tile_menu_tile_create(GRect bounds, uint16_t index) {
+    Layer * tile = s_pool_tiles;
+    if(tile) {
+        // Pooled tiles are reset to the state of a newly created one
+        s_pool_tiles = ((TileMenuTile*)layer_get_data(tile))->next;
+        s_pool_stats.spare_tiles--;
+        s_pool_stats.reuses++;
+        layer_set_frame(tile, bounds);
+        layer_set_bounds(tile, GRect(0, 0, bounds.size.w, bounds.size.h));
+        layer_set_update_proc(tile, NULL);
+        layer_set_hidden(tile, false);
+    } else {
+        tile = layer_create_with_data(bounds, sizeof(TileMenuTile));
+        if(!tile)
+            return NULL;
+        s_pool_stats.allocations++;
+    }
+    TileMenuTile * data = (TileMenuTile*)layer_get_data(tile);
+    data->next = NULL;
+    data->label = NULL;
+    data->index = index;
+    return tile;
+}
+
+static void tile_menu_tile_destroy(Layer * tile) {
+    if(!tile)
+        return;
+
+    TileMenuTile * data = (TileMenuTile*)layer_get_data(tile);
+    if(data->label && data->label->icon)
+        icon_cache_release(data->label->icon_id);
+    tile_label_destroy(data->label);
+    if(!s_pool_enabled || !s_pool_retaining || s_pool_stats.spare_tiles >= TILE_MENU_POOL_MAX_TILES) {
+        layer_destroy(tile);
+        return;
+    }
+
+    layer_remove_child_layers(tile);
+    layer_remove_from_parent(tile);
+    data->label = NULL;
+    data->next = s_pool_tiles;
+    s_pool_tiles = tile;
+    s_pool_stats.spare_tiles++;
+}
+
+// Rows are only reused by a TileMenu with the same tiles_per_row as their data holds a pointer per column
+static Layer * tile_menu_row_create(GRect frame, uint8_t columns) {
+    Layer * prev = NULL;
+    Layer * row = s_pool_rows;
+    while(row && ((TileMenuRow*)layer_get_data(row))->columns != columns) {
+        prev = row;
+        row = ((TileMenuRow*)layer_get_data(row))->next;
+    }
+
+    if(row) {
+        if(prev)
+            ((TileMenuRow*)layer_get_data(prev))->next = ((TileMenuRow*)layer_get_data(row))->next;
+        else
+            s_pool_rows = ((TileMenuRow*)layer_get_data(row))->next;
+        s_pool_stats.spare_rows--;
+        s_pool_stats.reuses++;
+        layer_set_frame(row, frame);
+        layer_set_bounds(row, GRect(0, 0, frame.size.w, frame.size.h));
+        layer_set_hidden(row, false);
+    } else {
+        row = layer_create_with_data(frame, sizeof(TileMenuRow) + (columns * sizeof(Layer*)));
+        if(!row)
+            return NULL;
+        s_pool_stats.allocations++;
+    }
+    TileMenuRow * data = (TileMenuRow*)layer_get_data(row);
+    data->next = NULL;
+    data->index = 0;
+    data->columns = columns;
+    data->count = 0;
+    return row;
+}
+
+static void tile_menu_row_destroy(Layer * row) {
+    if(!row)
+        return;
+    if(!s_pool_enabled || !s_pool_retaining || s_pool_stats.spare_rows >= TILE_MENU_POOL_MAX_ROWS) {
+        layer_destroy(row);
+        return;
+    }
+
+    TileMenuRow * data = (TileMenuRow*)layer_get_data(row);
+    layer_remove_child_layers(row);
+    layer_remove_from_parent(row);
+    data->count = 0;
+    data->next = s_pool_rows;
+    s_pool_rows = row;
+    s_pool_stats.spare_rows++;
+}
+
+// Row offsets are int16_t like the ScrollLayer content size, so taller content is refused
+static bool tile_menu_content_fits(int32_t height) {
+    return (height <= INT16_MAX);
+}
+
+// Catalog tiles are labelled from the record they are bound to, so only plain tiles can be given labels and icons
+static bool tile_menu_tile_editable(TileMenu * menu, Layer * tile) {
+    return (menu && tile && !menu->catalog);
+}
+
+// Content frame of tile @index straight from the row offset table, tile frames are relative to their row
+static GRect tile_menu_tile_frame(TileMenu * menu, uint16_t index) {
+    unsigned row = index / menu->tiles_per_row;
+    return GRect(menu->ulhs.x + ((index % menu->tiles_per_row) * menu->tile_width),
+                 menu->ulhs.y + menu->row_offsets[row],
+                 menu->tile_width,
+                 menu->row_offsets[row + 1] - menu->row_offsets[row]);
+}
+
+// Tile @index if its row is held by a container, always for plain TileMenus and only near the view for a catalog
+static Layer * tile_menu_tile_at(TileMenu * menu, uint16_t index) {
+    if(index >= menu->tile_count)
+        return NULL;
+
+    unsigned row = index / menu->tiles_per_row;
+    TileMenuRow * data = (TileMenuRow*)layer_get_data(menu->rows[row % menu->container_count]);
+    return (data->index == row ? data->tiles[index % menu->tiles_per_row] : NULL);
+}
+
+// Frames the container of @row from the row offset table, its tiles only need resizing if its height changed
+static void tile_menu_row_layout(TileMenu * menu, unsigned row, bool resize) {
+    Layer * container = menu->rows[row % menu->container_count];
+    int16_t height = menu->row_offsets[row + 1] - menu->row_offsets[row];
+    layer_set_frame(container, GRect(menu->ulhs.x, menu->ulhs.y + menu->row_offsets[row], menu->tiles_per_row * menu->tile_width, height));
+    if(!resize)
+        return;
+
+    TileMenuRow * data = (TileMenuRow*)layer_get_data(container);
+    for(uint8_t col = 0; col < data->count; ++col) {
+        layer_set_frame(data->tiles[col], GRect(col * menu->tile_width, 0, menu->tile_width, height));
+    }
+}
+
+static TileLabel * tile_menu_tile_label(Layer * tile) {
+    TileMenuTile * data = (TileMenuTile*)layer_get_data(tile);
+    if(!data->label) {
+        data->label = tile_label_create();
+        if(data->label)
+            layer_set_update_proc(tile, tile_menu_label_update_proc);
+    }
+    return data->label;
+}
+
+static void tile_menu_label_update_proc(Layer * layer, GContext * ctx) {
+    tile_label_draw(((TileMenuTile*)layer_get_data(layer))->label, ctx, layer_get_bounds(layer));
+}
+
+// Rows in view, plus TILE_MENU_PREFETCH_ROWS either side in the Full tier, hold their icons and records
+static void tile_menu_rows_in_view(TileMenu * menu, int * first, int * last) {
+    *first = 0;
+    *last = -1;
+    if(menu->container_count == 0)
+        return;
+
+    int16_t top = -(menu->selector ? menu->selector->offset.y : 0);
+    int16_t bottom = top + layer_get_bounds(scroll_layer_get_layer(menu->layer)).size.h - 1;
+    int16_t content = menu->row_offsets[menu->row_count];
+    int margin = (menu->tier == TileMenuMemoryTierFull ? TILE_MENU_PREFETCH_ROWS : 0);
+
+    *first = tile_menu_get_row_at(menu, (top < 0 ? 0 : top >= content ? content - 1 : top)) - margin;
+    *last = tile_menu_get_row_at(menu, (bottom < 0 ? 0 : bottom >= content ? content - 1 : bottom)) + margin;
+    if(*first < 0)
+        *first = 0;
+    if(*last >= (int)menu->row_count)
+        *last = menu->row_count - 1;
+}
+
+static void tile_menu_row_update(TileMenu * menu, unsigned row, bool visible) {
+    TileMenuRow * data = (TileMenuRow*)layer_get_data(menu->rows[row % menu->container_count]);
+    if(data->index != row)
+        return;
+
+    for(uint8_t col = 0; col < data->count; ++col) {
+        tile_menu_tile_icon_update(menu, data->tiles[col], visible);
+    }
+}
+
+static void tile_menu_tile_icon_update(TileMenu * menu, Layer * tile, bool visible) {
+    TileLabel * label = ((TileMenuTile*)layer_get_data(tile))->label;
+    if(!label || label->icon_id == 0)
+        return;
+
+    // Icons are the largest thing a tile holds so the Minimal tier draws tiles without them
+    visible = (visible && menu->tier != TileMenuMemoryTierMinimal);
+    if(visible && !label->icon) {
+        tile_label_set_icon(label, icon_cache_acquire(label->icon_id));
+        layer_mark_dirty(tile);
+    } else if(!visible && label->icon) {
+        tile_label_set_icon(label, NULL);
+        icon_cache_release(label->icon_id);
+        layer_mark_dirty(tile);
+    }
+}
+
+// Creates container @container with its tiles, catalog containers get a full row of hidden virtual tiles
+static bool tile_menu_container_create(TileMenu * menu, unsigned container) {
+    Layer * row = tile_menu_row_create(GRectZero, menu->tiles_per_row);
+    if(!row)
+        return false;
+
+    menu->rows[container] = row;
+    menu->container_count = container + 1;
+    TileMenuRow * data = (TileMenuRow*)layer_get_data(row);
+    data->index = (menu->catalog ? TILE_MENU_ROW_UNBOUND : container);
+
+    unsigned first = container * menu->tiles_per_row;
+    unsigned count = (menu->catalog || menu->tile_count - first > menu->tiles_per_row ? menu->tiles_per_row : menu->tile_count - first);
+    for(unsigned col = 0; col < count; ++col) {
+        Layer * tile = tile_menu_tile_create(GRectZero, first + col);
+        if(!tile || !xorlist_push_back(menu->tiles, (void*)tile)) {
+            tile_menu_tile_destroy(tile);
+            return false;
+        }
+        data->tiles[data->count++] = tile;
+        layer_add_child(row, tile);
+        if(menu->catalog) {
+            ((TileMenuTile*)layer_get_data(tile))->label = &menu->slots[first + col].label;
+            layer_set_update_proc(tile, tile_menu_label_update_proc);
+            layer_set_hidden(tile, true);
+        }
+    }
+
+    if(!menu->catalog)
+        tile_menu_row_layout(menu, container, true);
+    else if(menu->drawn)
+        scroll_layer_add_child(menu->layer, row);
+    return true;
+}
+
+// Catalog rows are direct-mapped onto the containers, row @row is only ever shown by container @row % container_count
+static void tile_menu_row_bind(TileMenu * menu, unsigned row) {
+    unsigned container = row % menu->container_count;
+    TileMenuRow * data = (TileMenuRow*)layer_get_data(menu->rows[container]);
+    if(data->index == row)
+        return;
+
+    tile_menu_row_unbind(menu, container);
+    data->index = row;
+    tile_menu_row_layout(menu, row, true);
+    for(uint8_t col = 0; col < data->count; ++col) {
+        Layer * tile = data->tiles[col];
+        TileMenuCatalogSlot * slot = &menu->slots[(container * menu->tiles_per_row) + col];
+        uint16_t index = (row * menu->tiles_per_row) + col;
+        bool loaded = (index < menu->tile_count && tile_catalog_read(menu->catalog, index, &slot->record));
+
+        ((TileMenuTile*)layer_get_data(tile))->index = index;
+        tile_label_set(&slot->label, (loaded ? slot->record.title : NULL),
+                       (loaded && slot->record.subtitle[0] ? slot->record.subtitle : NULL), menu->catalog_font);
+        tile_label_reserve_icon(&slot->label, (loaded ? slot->record.icon_id : 0), TILE_MENU_CATALOG_ICON_SIZE);
+        layer_set_hidden(tile, !loaded);
+        layer_mark_dirty(tile);
+    }
+}
+
+static void tile_menu_row_unbind(TileMenu * menu, unsigned container) {
+    TileMenuRow * data = (TileMenuRow*)layer_get_data(menu->rows[container]);
+    if(data->index == TILE_MENU_ROW_UNBOUND)
+        return;
+
+    tile_menu_row_update(menu, data->index, false);
+    data->index = TILE_MENU_ROW_UNBOUND;
+}
+
+// Shorter rows fit more rows in view so containers are added to keep every row in view on its own container
+static bool tile_menu_catalog_reserve(TileMenu * menu, int16_t height) {
+    int16_t view = layer_get_bounds(scroll_layer_get_layer(menu->layer)).size.h;
+    unsigned count = (unsigned)(view / height) + (2 * TILE_MENU_PREFETCH_ROWS) + 2;
+    if(count > menu->row_count)
+        count = menu->row_count;
+    if(count <= menu->container_count)
+        return true;
+
+    Layer ** rows = (Layer**)realloc(menu->rows, count * sizeof(Layer*));
+    if(!rows)
+        return false;
+    menu->rows = rows;
+    TileMenuCatalogSlot * slots = (TileMenuCatalogSlot*)calloc(count * menu->tiles_per_row, sizeof(TileMenuCatalogSlot));
+    if(!slots)
+        return false;
+
+    // The mapping of rows onto containers changes with their number so every row is bound again
+    for(unsigned container = 0; container < menu->container_count; ++container) {
+        tile_menu_row_unbind(menu, container);
+        TileMenuRow * data = (TileMenuRow*)layer_get_data(menu->rows[container]);
+        for(uint8_t col = 0; col < data->count; ++col) {
+            ((TileMenuTile*)layer_get_data(data->tiles[col]))->label = &slots[(container * menu->tiles_per_row) + col].label;
+        }
+    }
+    free(menu->slots);
+    menu->slots = slots;
+    menu->view_first = 0;
+    menu->view_last = -1;
+
+    for(unsigned container = menu->container_count; container < count; ++container) {
+        if(!tile_menu_container_create(menu, container))
+            return false;
+    }
+    return true;
+}
+
+// Rows leaving the view release what they hold and rows in view load theirs, no other row is visited
+static void tile_menu_tiles_update(TileMenu * menu) {
+    int first, last;
+    tile_menu_rows_in_view(menu, &first, &last);
+    for(int row = menu->view_first; row <= menu->view_last; ++row) {
+        if(row < first || row > last)
+            tile_menu_row_update(menu, row, false);
+    }
+
+    menu->view_first = first;
+    menu->view_last = last;
+    for(int row = first; row <= last; ++row) {
+        if(menu->catalog)
+            tile_menu_row_bind(menu, row);
+        tile_menu_row_update(menu, row, true);
+    }
+}
+
+static void tile_menu_selector_move(TileMenu * menu, uint16_t index) {
+    uint16_t curr = menu->selector->index;
+    menu->selector->index = index;
+    tile_menu_selector_set(menu, menu->selector, scroll_layer_get_layer(menu->layer),
+                           tile_menu_tile_frame(menu, curr), tile_menu_tile_frame(menu, index));
+}
+
+static void tile_menu_accel_data_handler(AccelData * data, uint32_t num_samples) {
+    TileMenu * menu = s_flick_menu;
+    if(!menu || !menu->flick || !data)
+        return;
+
+    // Flicks from the whole batch are coalesced into a single selector move
+    FlickSample samples[TILE_MENU_FLICK_MAX_BATCH];
+    int rows = 0;
+    for(uint32_t i = 0; i < num_samples; ) {
+        uint32_t count = 0;
+        for(; count < TILE_MENU_FLICK_MAX_BATCH && i < num_samples; ++count, ++i) {
+            samples[count] = (FlickSample) { data[i].x, data[i].y, data[i].z, data[i].did_vibrate };
+        }
+        rows += flick_detector_process(menu->flick, samples, count);
+    }
+
+    if(rows != 0)
+        tile_menu_set_selected_rows(menu, rows);
+}
+
+static void tile_menu_battery_state_handler(BatteryChargeState charge) {
+    if(charge.is_charging || charge.is_plugged)
+        s_battery_profile = TileMenuAnimationProfileFull;
+    else if(charge.charge_percent < TILE_MENU_BATTERY_NONE_PERCENT)
+        s_battery_profile = TileMenuAnimationProfileNone;
+    else if(charge.charge_percent < TILE_MENU_BATTERY_REDUCED_PERCENT)
+        s_battery_profile = TileMenuAnimationProfileReduced;
+    else
+        s_battery_profile = TileMenuAnimationProfileFull;
 }
 
 void tile_menu_iterator_init(TileMenu * menu, TileMenuIterator * itr, bool forward) {
@@ -78,24 +610,75 @@ void tile_menu_iterator_init(TileMenu * menu, TileMenuIterator * itr, bool forwa
     itr->at_end = (forward ? &xorlist_iterator_at_end : &xorlist_iterator_at_begin);
 }
 
-void tile_menu_selector_create(TileMenu * menu) {
-    if(!menu || menu->selector || xorlist_size(menu->tiles) <= 0)
+void tile_menu_memory_update(TileMenu * menu) {
+    if(!menu)
+        return;
+
+    size_t free_bytes = heap_bytes_free();
+    TileMenuMemoryTier tier = (free_bytes < menu->minimal_threshold ? TileMenuMemoryTierMinimal :
+                               free_bytes < menu->reduced_threshold ? TileMenuMemoryTierReduced :
+                               TileMenuMemoryTierFull);
+    if(tier == menu->tier)
         return;
 
-    menu->selector = (TileMenuSelector*)malloc(sizeof(TileMenuSelector));
+    if(menu->tier == TileMenuMemoryTierMinimal)
+        s_pool_minimal_menus--;
+    else if(tier == TileMenuMemoryTierMinimal)
+        s_pool_minimal_menus++;
+    menu->tier = tier;
+    tile_menu_pool_retention_update();
+    // Prefetched rows and icons are released, or reloaded, straight away rather than on the next scroll
+    if(menu->layer && menu->tiles)
+        tile_menu_tiles_update(menu);
+    if(menu->memory_tier_changed_handler) {
+        menu->memory_tier_changed_handler(menu, menu->tier, menu->context);
+    }
+}
+
+bool tile_menu_selector_create(TileMenu * menu) {
+    if(!menu || menu->selector || xorlist_size(menu->tiles) <= 0)
+        return true;
+
+    menu->selector = s_pool_selectors;
+    if(menu->selector) {
+        s_pool_selectors = menu->selector->next;
+        s_pool_stats.spare_selectors--;
+        s_pool_stats.reuses++;
+    } else {
+        menu->selector = (TileMenuSelector*)calloc(1, sizeof(TileMenuSelector));
+        if(!menu->selector)
+            return false;
+        s_pool_stats.allocations++;
+    }
+
+    menu->selector->next = NULL;
+    menu->selector->index = 0;
     menu->selector->offset = GPointZero;
-    tile_menu_iterator_init(menu, &menu->selector->iterator, true);
+    // Pooled selectors keep their InverterLayer, it only needs to be moved onto this TileMenu
+    if(menu->selector->inverter) {
+        layer_set_frame(inverter_layer_get_layer(menu->selector->inverter), tile_menu_tile_frame(menu, 0));
+        layer_add_child(scroll_layer_get_layer(menu->layer), inverter_layer_get_layer(menu->selector->inverter));
+        return true;
+    }
     tile_menu_selector_set(menu,
                            menu->selector, 
                            scroll_layer_get_layer(menu->layer), 
-                           layer_get_bounds((Layer*)((*menu->selector->iterator.curr)(&menu->selector->iterator.pointer))),
-                           layer_get_bounds((Layer*)((*menu->selector->iterator.curr)(&menu->selector->iterator.pointer))));
+                           tile_menu_tile_frame(menu, 0),
+                           tile_menu_tile_frame(menu, 0));
+    return (menu->selector->inverter != NULL);
 }
 
 void tile_menu_selector_destroy(TileMenuSelector * selector) {
     if(!selector)
         return;
     
+    if(s_pool_enabled && s_pool_retaining && selector->inverter && s_pool_stats.spare_selectors < TILE_MENU_POOL_MAX_SELECTORS) {
+        layer_remove_from_parent(inverter_layer_get_layer(selector->inverter));
+        selector->next = s_pool_selectors;
+        s_pool_selectors = selector;
+        s_pool_stats.spare_selectors++;
+        return;
+    }
     if(selector->inverter)
         inverter_layer_destroy(selector->inverter);
     
@@ -107,55 +690,33 @@ void tile_menu_selector_set(TileMenu * menu, TileMenuSelector * selector, Layer
         return;
 
     if(selector->inverter) {
-        bool content_changed = false;
         GSize max_bounds = layer_get_bounds(parent).size;
         // Base offset
         GPoint offset = selector->offset;
         GRect start = from;
         GRect finish = to;
-        GSize tile = to.size;
-        
-        start = GRect(start.origin.x,
-                      start.origin.y + abs(offset.y),
-                      start.size.w,
-                      start.size.h);
-        
-        GPoint origin = start.origin;
-        GPoint end = finish.origin;
         
         // Determines the relative left and right side boundaries
         //GRect bounds = layer_get_frame(parent);
-        //int rhs = bounds.origin.x + bounds.size.w - tile.w;
+        //int rhs = bounds.origin.x + bounds.size.w - finish.size.w;
         //int lhs = bounds.origin.x;
 
-        // Relative on-screen start coordinates
-        GPoint rel_start = from.origin;
-        // Top and bottom True coordinates of the relative frame
-        GPoint rframe_top = GPoint(0, origin.y - rel_start.y);
-        GPoint rframe_bot = GPoint(0, origin.y + max_bounds.h - rel_start.y);
-        // Relative on-screen end coordinates
-        GPoint rel_end = GPoint(end.x, end.y);
+        // Top of the relative frame and the row of the end tile, both from the START row
+        int16_t top = -offset.y;
+        int row = tile_menu_get_row_at(menu, finish.origin.y - menu->ulhs.y);
 
-        // Determined UP or DOWN shifting of the relative frame
+        // Determined UP or DOWN shifting of the relative frame straight from the row offsets
         // Shift UP
-        if(end.y < rframe_top.y) {
-            offset = GPoint(0, rframe_top.y - end.y + offset.y);
-            // Sets the new relative frame
-            rframe_top.y -= rframe_top.y - abs(offset.y);
-            rframe_bot.y = rframe_top.y + max_bounds.h;
-            content_changed = true;
-        }
+        if(row >= 0 && menu->row_offsets[row] < top)
+            top = menu->row_offsets[row];
         // Shift DOWN
-        else if (end.y >= rframe_bot.y) {
-            offset = GPoint(0, (-1 * (end.y - rframe_bot.y + tile.h)) + offset.y);
-            // Sets the new relative frame
-            rframe_top.y += abs(abs(offset.y) - rframe_top.y);
-            rframe_bot.y = rframe_top.y + max_bounds.h;
-            content_changed = true;
-        }
-        // Correct the relative end tile coordinates based on any movement
-        rel_end = GPoint(rel_end.x, end.y - rframe_top.y);
-        
+        else if(row >= 0 && menu->row_offsets[row + 1] > top + max_bounds.h)
+            top = menu->row_offsets[row + 1] - max_bounds.h;
+
+        bool content_changed = (top != -offset.y);
+        offset = GPoint(0, -top);
+        // Relative on-screen end coordinates after any movement
+        GPoint rel_end = GPoint(finish.origin.x, finish.origin.y + offset.y);
         
         /* !! N.B. Animation currently DISABLED 
         // rhs = Right-hand-side last row tile
@@ -165,82 +726,135 @@ void tile_menu_selector_set(TileMenu * menu, TileMenuSelector * selector, Layer
         // If moving from bot --> top then slide in from lhs
         // if moving from top --> bot then slide in from rhs
         if(finish.origin.x == lhs && start.origin.y != finish.origin.y) {
-            start.origin.x = lhs - tile.w;
+            start.origin.x = lhs - finish.size.w;
             start.origin.y = rel_end.y;
         } else if (finish.origin.x == rhs && start.origin.y != finish.origin.y) {
-            start.origin.x = rhs + tile.w;
+            start.origin.x = rhs + finish.size.w;
             start.origin.y = rel_end.y;
         } else if (gpoint_equal(&GPoint(finish.origin.x, finish.origin.y), &menu->ulhs) && 
                    gpoint_equal(&GPoint(start.origin.x, start.origin.y), &menu->lrhs)) {
-            start.origin.x = lhs - tile.w;
+            start.origin.x = lhs - finish.size.w;
             start.origin.y = rel_end.y;
         } else if (gpoint_equal(&GPoint(finish.origin.x, finish.origin.y), &menu->lrhs) && 
                    gpoint_equal(&GPoint(start.origin.x, start.origin.y), &menu->ulhs)) {
-            start.origin.x = rhs + tile.w;
+            start.origin.x = rhs + finish.size.w;
             start.origin.y = rel_end.y;
         }
         */
-        GRect true_start = GRect(start.origin.x, rel_start.y, start.size.w, start.size.h);
+        GRect true_start = GRect(start.origin.x, start.origin.y + selector->offset.y, start.size.w, start.size.h);
         GRect true_end = GRect(finish.origin.x, rel_end.y, finish.size.w, finish.size.h);
         
+        TileMenuAnimationProfile profile = tile_menu_get_animation_profile(menu);
+        
         selector->offset = offset;
-        scroll_layer_set_content_offset(menu->layer, offset, true);
-        animate_layer(inverter_layer_get_layer(selector->inverter), &true_start, &true_end,0,0);
+        scroll_layer_set_content_offset(menu->layer, offset, profile == TileMenuAnimationProfileFull);
+        if(profile == TileMenuAnimationProfileNone)
+            layer_set_frame(inverter_layer_get_layer(selector->inverter), true_end);
+        else
+            animate_layer(inverter_layer_get_layer(selector->inverter), &true_start, &true_end, TILE_MENU_SELECTOR_ANIMATION_DURATION, 0);
         
-        if(content_changed && menu->content_changed_handler) {
-            menu->content_changed_handler(menu, menu->context);
+        if(content_changed) {
+            tile_menu_memory_update(menu);
+            tile_menu_tiles_update(menu);
+            if(menu->content_changed_handler)
+                menu->content_changed_handler(menu, menu->context);
         }
     } else {
         selector->inverter = inverter_layer_create(to);
-        layer_add_child(parent, inverter_layer_get_layer(selector->inverter));
+        if(selector->inverter)
+            layer_add_child(parent, inverter_layer_get_layer(selector->inverter));
     }
 }
 
 
 
 TileMenu * tile_menu_create(GRect frame, Window * window, unsigned tiles, unsigned tiles_per_view, unsigned tiles_per_row) {
-    if(tiles_per_view == 0 || tiles_per_row == 0 || window == NULL)
+    return tile_menu_create_rows(frame, window, tiles, tiles_per_view, tiles_per_row, NULL, NULL);
+}
+
+TileMenu * tile_menu_create_with_catalog(GRect frame, Window * window, uint32_t resource_id, GFont font, unsigned tiles_per_view, unsigned tiles_per_row) {
+    TileCatalog * catalog = tile_catalog_create(resource_id);
+    if(!catalog)
+        return NULL;
+
+    return tile_menu_create_rows(frame, window, tile_catalog_get_count(catalog), tiles_per_view, tiles_per_row, catalog, font);
+}
+
+// Takes ownership of @catalog, plain TileMenus get a container and tiles for every row while a catalog
+// only gets enough containers to cover the view, which are bound to rows as it scrolls
+static TileMenu * tile_menu_create_rows(GRect frame, Window * window, unsigned tiles, unsigned tiles_per_view, unsigned tiles_per_row, TileCatalog * catalog, GFont font) {
+    if(tiles_per_view == 0 || tiles_per_row == 0 || tiles_per_row > UINT8_MAX || tiles > UINT16_MAX || window == NULL) {
+        tile_catalog_destroy(catalog);
         return NULL;
+    }
     
     int tile_height = frame.size.h / tiles_per_view;
     int tile_width = frame.size.w / tiles_per_row;
-    GSize max_size = GSize (
-        frame.size.w,
-        tile_height * ((int)DIVIDE_UP(tiles,tiles_per_view)) < 
-            frame.size.h ? frame.size.h : 
-            tile_height * ((int)DIVIDE_UP(tiles,tiles_per_view))
-        
-    );
+    unsigned rows = (tiles > 0 ? DIVIDE_UP(tiles,tiles_per_row) : 0);
+    if(tile_height <= 0 || !tile_menu_content_fits((int32_t)rows * tile_height)) {
+        tile_catalog_destroy(catalog);
+        return NULL;
+    }
 
-    TileMenu * menu = (TileMenu*)malloc(sizeof(struct _tile_menu_));
+    TileMenu * menu = (TileMenu*)calloc(1, sizeof(struct _tile_menu_));
+    if(!menu) {
+        tile_catalog_destroy(catalog);
+        return NULL;
+    }
     
-    menu->layer = scroll_layer_create(frame);
-    menu->tiles = xorlist_create();
-    menu->content_changed_handler = NULL;
     menu->context = menu;
     menu->ulhs = GPoint(frame.origin.x, frame.origin.y);
     menu->lrhs = menu->ulhs;
+    menu->tiles_per_row = tiles_per_row;
+    menu->tile_count = tiles;
+    menu->tile_width = tile_width;
+    menu->view_first = 0;
+    menu->view_last = -1;
+    menu->catalog = catalog;
+    menu->catalog_font = font;
+    menu->reduced_threshold = TILE_MENU_HEAP_REDUCED_THRESHOLD;
+    menu->minimal_threshold = TILE_MENU_HEAP_MINIMAL_THRESHOLD;
+    menu->live_next = s_live_menus;
+    s_live_menus = menu;
+    tile_menu_memory_update(menu);
+    tile_menu_pool_prune_rows();
     
-    for(unsigned i = 0; i < tiles; ++i) {
-        unsigned col = i % tiles_per_row;
-        unsigned row = DIVIDE_UP((i+1),tiles_per_view);
-        
-        GRect tile_bounds = GRect(
-            frame.origin.x + (col * tile_width),
-            frame.origin.y + ((row-1) * tile_height),
-            tile_width,
-            tile_height
-        );
-
-        menu->lrhs = GPoint(tile_bounds.origin.x, tile_bounds.origin.y);
-        
-        Layer * tile = layer_create(tile_bounds);
-        xorlist_push_back(menu->tiles, (void*)tile);
+    // A catalog only needs the rows in view, plus the prefetch margin on both sides and the partial rows at its edges
+    unsigned containers = rows;
+    unsigned view_rows = (unsigned)(frame.size.h / tile_height) + (2 * TILE_MENU_PREFETCH_ROWS) + 2;
+    if(catalog && containers > view_rows)
+        containers = view_rows;
+
+    menu->layer = scroll_layer_create(frame);
+    menu->tiles = xorlist_create();
+    menu->row_count = rows;
+    menu->row_offsets = (int16_t*)malloc((rows + 1) * sizeof(int16_t));
+    menu->rows = (Layer**)calloc(containers + 1, sizeof(Layer*));
+    if(catalog)
+        menu->slots = (TileMenuCatalogSlot*)calloc((containers * tiles_per_row) + 1, sizeof(TileMenuCatalogSlot));
+    if(!menu->layer || !menu->tiles || !menu->row_offsets || !menu->rows || (catalog && !menu->slots)) {
+        tile_menu_destroy(menu);
+        return NULL;
+    }
+    
+    // Every row starts at the default height until set by tile_menu_set_row_height()
+    for(unsigned row = 0; row <= rows; ++row) {
+        menu->row_offsets[row] = row * tile_height;
     }
     
-    scroll_layer_set_content_size(menu->layer, GSize(0, max_size.h));
+    // Tiles are framed inside a container Layer per row, so resizing a row only moves the containers below it
+    for(unsigned container = 0; container < containers; ++container) {
+        if(!tile_menu_container_create(menu, container)) {
+            tile_menu_destroy(menu);
+            return NULL;
+        }
+    }
+    if(tiles > 0)
+        menu->lrhs = tile_menu_tile_frame(menu, tiles - 1).origin;
+    
+    scroll_layer_set_content_size(menu->layer, GSize(0, menu->row_offsets[rows] < frame.size.h ? frame.size.h : menu->row_offsets[rows]));
     // Tile height offsets when srolling
-    scroll_layer_set_content_offset(menu->layer, GPoint(0, tile_height), true);
+    scroll_layer_set_content_offset(menu->layer, GPoint(0, tile_height), tile_menu_get_animation_profile(menu) == TileMenuAnimationProfileFull);
     // Sets the default context to be TilemMenu*
     scroll_layer_set_context(menu->layer, (void*)menu);
     /*
@@ -253,34 +867,76 @@ TileMenu * tile_menu_create(GRect frame, Window * window, unsigned tiles, unsign
     window_set_click_config_provider_with_context(window, tile_menu_click_config_provider, (void*)menu);
     
     tile_menu_iterator_init(menu, &menu->iterator, true);
-    tile_menu_selector_create(menu);
+    if(!tile_menu_selector_create(menu)) {
+        tile_menu_destroy(menu);
+        return NULL;
+    }
+    // Catalog containers are bound to the rows in view so the selected tile exists before drawing
+    if(catalog)
+        tile_menu_tiles_update(menu);
     
     return menu;
 }
 
+bool tile_menu_get_catalog_record(TileMenu * menu, uint16_t index, TileCatalogRecord * record) {
+    return (menu ? tile_catalog_read(menu->catalog, index, record) : false);
+}
+
 void tile_menu_destroy(TileMenu * menu) {
     if(menu) {
+        tile_menu_destroy(menu->child);
+        if(menu->parent)
+            menu->parent->child = NULL;
+        tile_menu_set_flick_scroll(menu, false, 0);
+        tile_menu_set_animation_profile(menu, TileMenuAnimationProfileFull);
         tile_menu_selector_destroy(menu->selector);
         if(menu->tiles) {
             for(XORListIterator itr = xorlist_iterator_forward(menu->tiles);
                 !xorlist_iterator_at_end(&itr);
                 xorlist_iterator_next(&itr)) {
-                layer_destroy((Layer*)xorlist_iterator_curr(&itr));
+                Layer * tile = (Layer*)xorlist_iterator_curr(&itr);
+                // Virtual tiles draw the label of their catalog slot, which is freed with the slots
+                if(menu->catalog) {
+                    TileMenuTile * data = (TileMenuTile*)layer_get_data(tile);
+                    if(data->label->icon)
+                        icon_cache_release(data->label->icon_id);
+                    data->label = NULL;
+                }
+                tile_menu_tile_destroy(tile);
             }
         }
         xorlist_destroy(menu->tiles);
-        scroll_layer_destroy(menu->layer);
+        for(unsigned container = 0; menu->rows && container < menu->container_count; ++container) {
+            tile_menu_row_destroy(menu->rows[container]);
+        }
+        free(menu->rows);
+        free(menu->slots);
+        tile_catalog_destroy(menu->catalog);
+        free(menu->row_offsets);
+        if(menu->layer)
+            scroll_layer_destroy(menu->layer);
+        for(TileMenu ** link = &s_live_menus; *link; link = &(*link)->live_next) {
+            if(*link == menu) {
+                *link = menu->live_next;
+                break;
+            }
+        }
+        // Left Minimal only once its objects are freed rather than kept by the pool
+        if(menu->tier == TileMenuMemoryTierMinimal) {
+            s_pool_minimal_menus--;
+            tile_menu_pool_retention_update();
+        }
+        free(menu);
     }
 }
 
 void tile_menu_draw(TileMenu * menu) {
     if(menu) {
-        for(XORListIterator itr = xorlist_iterator_forward(menu->tiles);
-            !xorlist_iterator_at_end(&itr);
-            xorlist_iterator_next(&itr)) {
-            Layer * layer = (Layer*)xorlist_iterator_curr(&itr);
-            scroll_layer_add_child(menu->layer, layer);
+        for(unsigned container = 0; container < menu->container_count; ++container) {
+            scroll_layer_add_child(menu->layer, menu->rows[container]);
         }
+        menu->drawn = true;
+        tile_menu_tiles_update(menu);
     }
 }
 
@@ -294,16 +950,199 @@ void tile_menu_set_callbacks(TileMenu * menu, TileMenuCallbacks callbacks) {
     if(!menu)
         return;
 
-    if(callbacks.click_config_provider && layer_get_window(scroll_layer_get_layer(menu->layer))) {
-        window_set_click_config_provider_with_context(
-            layer_get_window(scroll_layer_get_layer(menu->layer)), 
-            callbacks.click_config_provider, 
-            menu->context
-        );
+    if(callbacks.click_config_provider) {
+        menu->click_config_provider = callbacks.click_config_provider;
+        tile_menu_click_config_apply(menu);
     }
     if(callbacks.content_changed_handler) {
         menu->content_changed_handler = callbacks.content_changed_handler;
     }
+    if(callbacks.memory_tier_changed_handler) {
+        menu->memory_tier_changed_handler = callbacks.memory_tier_changed_handler;
+        menu->memory_tier_changed_handler(menu, menu->tier, menu->context);
+    }
+    if(callbacks.select_handler) {
+        menu->select_handler = callbacks.select_handler;
+    }
+}
+
+void tile_menu_set_memory_thresholds(TileMenu * menu, size_t reduced, size_t minimal) {
+    if(!menu)
+        return;
+
+    menu->reduced_threshold = reduced;
+    menu->minimal_threshold = minimal;
+    tile_menu_memory_update(menu);
+}
+
+TileMenuMemoryTier tile_menu_get_memory_tier(TileMenu * menu) {
+    return (menu ? menu->tier : TileMenuMemoryTierMinimal);
+}
+
+void tile_menu_set_animation_profile(TileMenu * menu, TileMenuAnimationProfile profile) {
+    if(!menu || menu->profile == profile)
+        return;
+
+    if(profile == TileMenuAnimationProfileAuto) {
+        if(s_battery_subscribers++ == 0) {
+            tile_menu_battery_state_handler(battery_state_service_peek());
+            battery_state_service_subscribe(tile_menu_battery_state_handler);
+        }
+    } else if(menu->profile == TileMenuAnimationProfileAuto) {
+        if(--s_battery_subscribers == 0)
+            battery_state_service_unsubscribe();
+    }
+    menu->profile = profile;
+}
+
+TileMenuAnimationProfile tile_menu_get_animation_profile(TileMenu * menu) {
+    if(!menu)
+        return TileMenuAnimationProfileNone;
+    // Animations allocate on the heap so they are skipped outside the Full tier
+    if(menu->tier != TileMenuMemoryTierFull)
+        return TileMenuAnimationProfileNone;
+    return (menu->profile == TileMenuAnimationProfileAuto ? s_battery_profile : menu->profile);
+}
+
+bool tile_menu_set_tile_label(TileMenu * menu, Layer * tile, const char * title, const char * subtitle, GFont font) {
+    if(!tile_menu_tile_editable(menu, tile))
+        return false;
+
+    TileLabel * label = tile_menu_tile_label(tile);
+    if(!label)
+        return false;
+
+    tile_label_set(label, title, subtitle, font);
+    layer_mark_dirty(tile);
+    return true;
+}
+
+bool tile_menu_set_tile_icon(TileMenu * menu, Layer * tile, uint32_t resource_id, GSize size) {
+    if(!tile_menu_tile_editable(menu, tile))
+        return false;
+
+    TileLabel * label = tile_menu_tile_label(tile);
+    if(!label)
+        return false;
+
+    if(label->icon) {
+        tile_label_set_icon(label, NULL);
+        icon_cache_release(label->icon_id);
+    }
+    tile_label_reserve_icon(label, resource_id, size);
+    int row = ((TileMenuTile*)layer_get_data(tile))->index / menu->tiles_per_row;
+    tile_menu_tile_icon_update(menu, tile, (row >= menu->view_first && row <= menu->view_last));
+    layer_mark_dirty(tile);
+    return true;
+}
+
+bool tile_menu_push(TileMenu * menu, TileMenu * child) {
+    if(!menu || !child || menu == child || menu->child || child->parent || !tile_menu_get_window(menu))
+        return false;
+
+    menu->child = child;
+    child->parent = menu;
+
+    // Flick scrolling follows the visible level
+    if(s_flick_menu == menu) {
+        s_flick_menu = child;
+        free(child->flick);
+        child->flick = menu->flick;
+        menu->flick = NULL;
+    }
+
+    // The parent keeps its Layers and selector, it is only hidden until the child is popped
+    layer_set_hidden(tile_menu_get_layer(menu), true);
+    if(!tile_menu_get_window(child))
+        layer_add_child(window_get_root_layer(tile_menu_get_window(menu)), tile_menu_get_layer(child));
+    tile_menu_click_config_apply(child);
+    return true;
+}
+
+TileMenu * tile_menu_pop(TileMenu * menu) {
+    if(!menu || !menu->parent || menu->child)
+        return NULL;
+
+    TileMenu * parent = menu->parent;
+    if(s_flick_menu == menu) {
+        s_flick_menu = parent;
+        parent->flick = menu->flick;
+        menu->flick = NULL;
+    }
+
+    layer_remove_from_parent(tile_menu_get_layer(menu));
+    tile_menu_destroy(menu);
+
+    layer_set_hidden(tile_menu_get_layer(parent), false);
+    tile_menu_click_config_apply(parent);
+    return parent;
+}
+
+TileMenu * tile_menu_get_parent(TileMenu * menu) {
+    return (menu ? menu->parent : NULL);
+}
+
+TileMenuState tile_menu_get_state(TileMenu * menu) {
+    TileMenuState state = { 0, 0 };
+    if(!menu || !menu->selector)
+        return state;
+
+    state.selected = menu->selector->index;
+    state.offset = menu->selector->offset.y;
+    return state;
+}
+
+void tile_menu_set_state(TileMenu * menu, TileMenuState state) {
+    if(!menu || !menu->selector || !menu->selector->inverter)
+        return;
+
+    menu->selector->index = (state.selected < menu->tile_count ? state.selected : menu->tile_count - 1);
+
+    // Restores straight into the final layout so it is drawn in a single frame
+    GRect tile = tile_menu_tile_frame(menu, menu->selector->index);
+    menu->selector->offset = GPoint(0, state.offset);
+    scroll_layer_set_content_offset(menu->layer, menu->selector->offset, false);
+    layer_set_frame(inverter_layer_get_layer(menu->selector->inverter),
+                    GRect(tile.origin.x, tile.origin.y + state.offset, tile.size.w, tile.size.h));
+    tile_menu_tiles_update(menu);
+}
+
+bool tile_menu_set_flick_scroll(TileMenu * menu, bool enabled, uint32_t samples_per_batch) {
+    if(!menu)
+        return false;
+
+    if(!enabled) {
+        if(s_flick_menu == menu) {
+            accel_data_service_unsubscribe();
+            s_flick_menu = NULL;
+        }
+        free(menu->flick);
+        menu->flick = NULL;
+        return true;
+    }
+
+    if(s_flick_menu && s_flick_menu != menu)
+        return false;
+
+    if(!menu->flick) {
+        menu->flick = (FlickDetector*)malloc(sizeof(FlickDetector));
+        if(!menu->flick)
+            return false;
+    }
+    flick_detector_init(menu->flick);
+
+    if(samples_per_batch < TILE_MENU_FLICK_MIN_BATCH)
+        samples_per_batch = TILE_MENU_FLICK_MIN_BATCH;
+    else if(samples_per_batch > TILE_MENU_FLICK_MAX_BATCH)
+        samples_per_batch = TILE_MENU_FLICK_MAX_BATCH;
+
+    if(s_flick_menu == menu)
+        accel_data_service_unsubscribe();
+
+    s_flick_menu = menu;
+    accel_data_service_subscribe(samples_per_batch, tile_menu_accel_data_handler);
+    accel_service_set_sampling_rate(ACCEL_SAMPLING_25HZ);
+    return true;
 }
 
 GRect tile_menu_get_bounds(TileMenu * menu) {
@@ -335,7 +1174,7 @@ Layer * tile_menu_get_curr(TileMenu * menu) {
 }
 
 int tile_menu_get_tile_count(TileMenu * menu) {
-    return (menu ? xorlist_size(menu->tiles) : -1);
+    return (menu ? menu->tile_count : -1);
 }
 
 Window * tile_menu_get_window(TileMenu * menu) {
@@ -355,35 +1194,112 @@ bool tile_menu_at_begin(TileMenu * menu) {
 }
 
 Layer * tile_menu_get_selected(TileMenu * menu) {
-    return (menu && menu->selector ? (Layer*)((*menu->selector->iterator.curr)(&menu->selector->iterator.pointer)) : NULL);
+    return (menu && menu->selector ? tile_menu_tile_at(menu, menu->selector->index) : NULL);
 }
 
 void tile_menu_set_selected_next(TileMenu * menu) {
     if(!menu || !menu->selector)
         return;
 
-    Layer * curr = (Layer*)((*menu->selector->iterator.curr)(&menu->selector->iterator.pointer));
-    Layer * layer = (Layer*)((*menu->selector->iterator.next)(&menu->selector->iterator.pointer));
-    if((*menu->selector->iterator.at_end)(&menu->selector->iterator.pointer)) {
-        tile_menu_iterator_init(menu, &menu->selector->iterator, true);
-        layer = (Layer*)((*menu->selector->iterator.curr)(&menu->selector->iterator.pointer));
-    } 
-    
-    if(layer)
-        tile_menu_selector_set(menu, menu->selector, scroll_layer_get_layer(menu->layer), layer_get_frame(curr), layer_get_frame(layer));
+    tile_menu_selector_move(menu, (menu->selector->index + 1 < menu->tile_count ? menu->selector->index + 1 : 0));
 }
 
 void tile_menu_set_selected_prev(TileMenu * menu) {
     if(!menu || !menu->selector)
         return;
 
-    Layer * curr = (Layer*)((*menu->selector->iterator.curr)(&menu->selector->iterator.pointer));
-    Layer * layer = (Layer*)((*menu->selector->iterator.prev)(&menu->selector->iterator.pointer));
-    if((*menu->selector->iterator.at_begin)(&menu->selector->iterator.pointer)) {
-        tile_menu_iterator_init(menu, &menu->selector->iterator, false);
-        layer = (Layer*)((*menu->selector->iterator.curr)(&menu->selector->iterator.pointer));
-    } 
+    tile_menu_selector_move(menu, (menu->selector->index > 0 ? menu->selector->index - 1 : menu->tile_count - 1));
+}
+
+void tile_menu_set_selected_rows(TileMenu * menu, int rows) {
+    if(!menu || !menu->selector || rows == 0)
+        return;
+
+    // Stops on the START or END tile rather than looping so a hard flick cannot overshoot
+    int32_t index = menu->selector->index + (rows * (int32_t)menu->tiles_per_row);
+    if(index < 0)
+        index = 0;
+    else if(index >= menu->tile_count)
+        index = menu->tile_count - 1;
     
-    if(layer)
-        tile_menu_selector_set(menu, menu->selector, scroll_layer_get_layer(menu->layer), layer_get_frame(curr), layer_get_frame(layer));
+    if(index != menu->selector->index)
+        tile_menu_selector_move(menu, index);
+}
+
+bool tile_menu_set_row_height(TileMenu * menu, unsigned row, int16_t height) {
+    if(!menu || row >= menu->row_count || height <= 0)
+        return false;
+
+    int32_t delta = height - (menu->row_offsets[row + 1] - menu->row_offsets[row]);
+    if(delta == 0)
+        return true;
+    if(!tile_menu_content_fits(menu->row_offsets[menu->row_count] + delta))
+        return false;
+    if(menu->catalog && !tile_menu_catalog_reserve(menu, height))
+        return false;
+
+    for(unsigned r = row + 1; r <= menu->row_count; ++r) {
+        menu->row_offsets[r] += delta;
+    }
+
+    // Only the tiles of @row are resized, the rows below it move as whole containers
+    for(unsigned container = 0; container < menu->container_count; ++container) {
+        unsigned r = ((TileMenuRow*)layer_get_data(menu->rows[container]))->index;
+        if(r != TILE_MENU_ROW_UNBOUND && r >= row)
+            tile_menu_row_layout(menu, r, r == row);
+    }
+    menu->lrhs.y = menu->ulhs.y + menu->row_offsets[menu->row_count - 1];
+
+    int16_t view = layer_get_bounds(scroll_layer_get_layer(menu->layer)).size.h;
+    int16_t content = menu->row_offsets[menu->row_count];
+    scroll_layer_set_content_size(menu->layer, GSize(0, content < view ? view : content));
+
+    // Keeps the selector on its tile and the offset within the new content
+    TileMenuState state = tile_menu_get_state(menu);
+    if(-state.offset > content - view)
+        state.offset = (content > view ? view - content : 0);
+    tile_menu_set_state(menu, state);
+    return true;
+}
+
+int16_t tile_menu_get_row_height(TileMenu * menu, unsigned row) {
+    return (menu && row < menu->row_count ? menu->row_offsets[row + 1] - menu->row_offsets[row] : -1);
+}
+
+int tile_menu_get_row_at(TileMenu * menu, int16_t offset) {
+    if(!menu || menu->row_count == 0 || offset < 0 || offset >= menu->row_offsets[menu->row_count])
+        return -1;
+
+    // Last row starting at or before @offset
+    unsigned lo = 0;
+    unsigned hi = menu->row_count - 1;
+    while(lo < hi) {
+        unsigned mid = (lo + hi + 1) / 2;
+        if(menu->row_offsets[mid] <= offset)
+            lo = mid;
+        else
+            hi = mid - 1;
+    }
+    return lo;
+}
+
+void tile_menu_pool_init(void) {
+    s_pool_enabled = true;
+    xorlist_set_spare_node_limit(TILE_MENU_POOL_MAX_TILES);
+    tile_menu_pool_retention_update();
+}
+
+void tile_menu_pool_deinit(void) {
+    s_pool_enabled = false;
+    xorlist_set_node_recycling(false);
+    tile_menu_pool_drain();
+}
+
+TileMenuPoolStats tile_menu_pool_get_stats(void) {
+    XORListNodeStats nodes = xorlist_get_node_stats();
+    TileMenuPoolStats stats = s_pool_stats;
+    stats.spare_nodes = nodes.spare;
+    stats.node_allocations = nodes.allocations;
+    stats.node_reuses = nodes.reuses;
+    return stats;
 }
@@ -3,9 +3,121 @@
  */
 #include <pebble.h>
 #include "animator.h"
+#include "tile_catalog.h"
+
+// Free heap (bytes) below which TileMenu drops to the Reduced memory tier
+#ifndef TILE_MENU_HEAP_REDUCED_THRESHOLD
+#define TILE_MENU_HEAP_REDUCED_THRESHOLD    4096
+#endif
+// Free heap (bytes) below which TileMenu drops to the Minimal memory tier
+#ifndef TILE_MENU_HEAP_MINIMAL_THRESHOLD
+#define TILE_MENU_HEAP_MINIMAL_THRESHOLD    1536
+#endif
+
+/**    TileMenu Memory Tiers
+ *    @brief: Memory footprint TileMenu has chosen based on the free heap.
+ *
+ *    @TileMenuMemoryTierFull       Animations follow the TileMenuAnimationProfile and icons and
+ *                                  catalog records are prefetched TILE_MENU_PREFETCH_ROWS either
+ *                                  side of the view.
+ *    @TileMenuMemoryTierReduced    Animations are skipped as if TileMenuAnimationProfileNone is set
+ *                                  and only the tiles in view hold icons and catalog records.
+ *    @TileMenuMemoryTierMinimal    As Reduced, plus tiles are drawn without their icons, which are
+ *                                  released from the icon cache, and the TileMenuPool frees its
+ *                                  spare objects and keeps no more until the tier is left.
+ */
+typedef enum {
+    TileMenuMemoryTierFull,
+    TileMenuMemoryTierReduced,
+    TileMenuMemoryTierMinimal
+} TileMenuMemoryTier;
+
+// Bounds on the accelerometer samples delivered per batch when flick scrolling
+#define TILE_MENU_FLICK_MIN_BATCH           10
+#define TILE_MENU_FLICK_MAX_BATCH           25
+
+// Selector animation duration (ms), 0 moves it in a single animation frame as TileMenu always has
+#define TILE_MENU_SELECTOR_ANIMATION_DURATION 0
+// Battery charge (%) below which the Auto profile drops to Reduced and None
+#define TILE_MENU_BATTERY_REDUCED_PERCENT   50
+#define TILE_MENU_BATTERY_NONE_PERCENT      20
+
+/**    TileMenu Animation Profiles
+ *    @brief: How much animation TileMenu runs when the selector moves.
+ *
+ *    @TileMenuAnimationProfileFull       The content scrolls with the ScrollLayer animation and the
+ *                                        selector is moved by a TILE_MENU_SELECTOR_ANIMATION_DURATION
+ *                                        animation, the same timings TileMenu has always used.
+ *    @TileMenuAnimationProfileReduced    As Full but the content snaps to its new offset, dropping
+ *                                        the frames of the scroll animation.
+ *    @TileMenuAnimationProfileNone       Selector and content snap to the final layout with a 
+ *                                        single redraw and no Animation is allocated.
+ *    @TileMenuAnimationProfileAuto       Chooses one of the above from the battery state, Full 
+ *                                        while charging.
+ */
+typedef enum {
+    TileMenuAnimationProfileFull,
+    TileMenuAnimationProfileReduced,
+    TileMenuAnimationProfileNone,
+    TileMenuAnimationProfileAuto
+} TileMenuAnimationProfile;
+
+/**    TileMenu State
+ *    @brief: Compact snapshot of the selected tile and scroll offset of a TileMenu,
+ *            used to restore a level without rebuilding its selector.
+ *
+ *    @selected    Index of the selected tile from the START tile
+ *    @offset      Vertical scroll offset of the content
+ */
+typedef struct _tile_menu_state_ {
+    uint16_t selected;
+    int16_t  offset;
+} TileMenuState;
+
+// Rows either side of the view whose tile icons and catalog records stay loaded in the Full memory tier
+#define TILE_MENU_PREFETCH_ROWS             1
+// Most spare tiles, and their list nodes, row containers and selectors the TileMenuPool keeps, the rest are freed
+#ifndef TILE_MENU_POOL_MAX_TILES
+#define TILE_MENU_POOL_MAX_TILES            48
+#endif
+#ifndef TILE_MENU_POOL_MAX_ROWS
+#define TILE_MENU_POOL_MAX_ROWS             24
+#endif
+#ifndef TILE_MENU_POOL_MAX_SELECTORS
+#define TILE_MENU_POOL_MAX_SELECTORS        2
+#endif
+// Box reserved above the label of catalog tiles whose record names an icon
+#ifndef TILE_MENU_CATALOG_ICON_SIZE
+#define TILE_MENU_CATALOG_ICON_SIZE         GSize(24, 24)
+#endif
+
+/**    TileMenuPool Statistics
+ *    @brief: Counters of the objects TileMenus allocate and recycle through the TileMenuPool.
+ *
+ *    @spare_tiles        Tile Layers currently kept by the pool
+ *    @spare_rows         Row container Layers currently kept by the pool
+ *    @spare_selectors    Selectors, with their InverterLayer, currently kept by the pool
+ *    @spare_nodes        XORList nodes of the tile lists currently kept by the pool
+ *    @allocations        Tile and row Layers and selectors allocated from the heap since start up
+ *    @reuses             Tile and row Layers and selectors taken from the pool instead of the heap
+ *    @node_allocations   XORList nodes allocated from the heap since start up
+ *    @node_reuses        XORList nodes taken from the pool instead of the heap
+ */
+typedef struct _tile_menu_pool_stats_ {
+    uint16_t spare_tiles;
+    uint16_t spare_rows;
+    uint16_t spare_selectors;
+    uint16_t spare_nodes;
+    uint32_t allocations;
+    uint32_t reuses;
+    uint32_t node_allocations;
+    uint32_t node_reuses;
+} TileMenuPoolStats;
 
 typedef struct _tile_menu_ TileMenu;
 typedef void (*TileMenuCallback)(TileMenu * menu, void * context);
+typedef void (*TileMenuMemoryTierCallback)(TileMenu * menu, TileMenuMemoryTier tier, void * context);
+typedef void (*TileMenuSelectCallback)(TileMenu * menu, uint16_t index, void * context);
 
 /**    TileMenu Callbacks
  *    @brief: All the callbacks that the TileMenu exposes for use by applications.
@@ -18,10 +130,20 @@ typedef void (*TileMenuCallback)(TileMenu * menu, void * context);
  *    @content_changed_handler    Called every time the content on-screen changes, this occurs
  *                                when a scroll event has been resolved and tiles have been
  *                                reloaded.
+ *
+ *    @memory_tier_changed_handler    Called with the current tier when first set and every
+ *                                time the TileMenu changes its memory tier.
+ *
+ *    @select_handler             Called with the index of the selected tile when SELECT is
+ *                                clicked, e.g. to tile_menu_push() a child level. Unlike a
+ *                                @click_config_provider it keeps the default UP, DOWN and
+ *                                BACK bindings.
  */
 typedef struct _tile_menu_callbacks_ {
     ClickConfigProvider click_config_provider;
     TileMenuCallback content_changed_handler;
+    TileMenuMemoryTierCallback memory_tier_changed_handler;
+    TileMenuSelectCallback select_handler;
 } TileMenuCallbacks;
 
 
@@ -34,13 +156,39 @@ typedef struct _tile_menu_callbacks_ {
  *    @tiles_per_view    Number of tiles displayed vertically, i.e. rows
  *    @tiles_per_row     Number of tiles displayed horizontally, i.e. columns
  *
- *    @returns: Newly created and initialised TileMenu to be attached to a window
+ *    @returns: Newly created and initialised TileMenu to be attached to a window, 
+ *              NULL if invalid arguments, the content would be taller than INT16_MAX
+ *              or there is not enough heap to create it.
  *
  *    N.B. TileMenu is NOT automatically attached to a window since base Layer
  *         objects are used and therefore need to be initialised by the application
  *         before they are drawn by the TileMenu and hence attached to a window.
  */
 TileMenu *      tile_menu_create(GRect frame, Window * window, unsigned tiles, unsigned tiles_per_view, unsigned tiles_per_row);
+/**   Create From Catalog Method 
+ *    @brief: Creates a new TileMenu over every record of the TileCatalog resource
+ *            @resource_id, drawn with the built-in label renderer in @font. Only
+ *            enough tiles to cover the view and TILE_MENU_PREFETCH_ROWS either side
+ *            are created, and they are moved onto the records coming into view as
+ *            the TileMenu scrolls, reading each record by byte range. The content
+ *            height comes from the record count and row heights alone. Record icons
+ *            are given a box of TILE_MENU_CATALOG_ICON_SIZE.
+ *
+ *    @returns: Newly created TileMenu as tile_menu_create(), NULL if @resource_id is 
+ *              not a valid TileCatalog or there is not enough heap.
+ *
+ *    N.B. See tile_catalog.h for the format and tools/tile_catalog_pack.py to build it.
+ *         tile_menu_get_tile_count() is the record count but iterating the
+ *         TileMenu only reaches the tiles near the view.
+ */
+TileMenu *      tile_menu_create_with_catalog(GRect frame, Window * window, uint32_t resource_id, GFont font, unsigned tiles_per_view, unsigned tiles_per_row);
+/**    Get Catalog Record
+ *    @brief: Reads the catalog record of the tile at @index, e.g. tile_menu_get_state().selected
+ *            to find the action code of the selected tile.
+ *    @returns: @true on success, @false if the TileMenu was not created from a catalog 
+ *              or @index is out of range.
+ */
+bool            tile_menu_get_catalog_record(TileMenu * menu, uint16_t index, TileCatalogRecord * record);
 /**    Destroy Method
  *    @brief: Destroys the TileMenu and all of its tiles and any other objects creatd on the heap
  */
@@ -69,6 +217,111 @@ void            tile_menu_set_context(TileMenu * menu, void * context);
  */
 void            tile_menu_set_callbacks(TileMenu * menu, TileMenuCallbacks callbacks);
 
+/**    Memory Thresholds Override
+ *    @brief: Sets the free heap thresholds (in bytes) below which the TileMenu drops to
+ *            the Reduced and Minimal memory tiers and re-evaluates the tier immediately.
+ *            Defaults are TILE_MENU_HEAP_REDUCED_THRESHOLD and TILE_MENU_HEAP_MINIMAL_THRESHOLD.
+ *
+ *    N.B. The free heap is checked on creation and every time the content changes.
+ */
+void            tile_menu_set_memory_thresholds(TileMenu * menu, size_t reduced, size_t minimal);
+/**    Get Memory Tier
+ *    @brief: Gets the memory tier the TileMenu is currently running in.
+ *    @returns: The current TileMenuMemoryTier, TileMenuMemoryTierMinimal if uninitialised TileMenu.
+ */
+TileMenuMemoryTier tile_menu_get_memory_tier(TileMenu * menu);
+
+/**    Animation Profile Override
+ *    @brief: Sets the TileMenuAnimationProfile used for both the scroll and the selector,
+ *            the default is TileMenuAnimationProfileFull. TileMenuAnimationProfileAuto
+ *            subscribes to the battery_state_service and follows the charge level.
+ *
+ *    N.B. Any memory tier other than TileMenuMemoryTierFull overrides this with
+ *         TileMenuAnimationProfileNone.
+ */
+void            tile_menu_set_animation_profile(TileMenu * menu, TileMenuAnimationProfile profile);
+/**    Get Animation Profile
+ *    @brief: Gets the animation profile the TileMenu is currently animating with, resolving
+ *            TileMenuAnimationProfileAuto and the memory tier.
+ *    @returns: The active TileMenuAnimationProfile, TileMenuAnimationProfileNone if uninitialised TileMenu.
+ */
+TileMenuAnimationProfile tile_menu_get_animation_profile(TileMenu * menu);
+
+/**    Set Tile Label
+ *    @brief: Draws @tile with the built-in label renderer, @title and optional @subtitle
+ *            centred in @font. The text is measured once and the frames it is drawn in
+ *            are cached, they are only measured again when this is called or the tile
+ *            changes size. The text itself is still laid out on every draw.
+ *            This replaces any update_proc already set on @tile.
+ *    @returns: @true on success, @false if there is not enough heap for the label or @menu
+ *              was created from a catalog.
+ *
+ *    N.B. @tile must be a tile of @menu. Strings are NOT copied and must outlive the TileMenu.
+ */
+bool            tile_menu_set_tile_label(TileMenu * menu, Layer * tile, const char * title, const char * subtitle, GFont font);
+
+/**    Set Tile Icon
+ *    @brief: Draws the icon of @resource_id above the label of @tile with the built-in
+ *            label renderer, or removes the icon if @resource_id is 0. A box of @size,
+ *            normally the size of the icon bitmap, is reserved for it so the label does
+ *            not move as the bitmap is loaded and released. Icon bitmaps are shared by
+ *            all tiles and TileMenus through a reference counted cache. They are only
+ *            loaded while the tile is in view and released when it scrolls out of view
+ *            or the TileMenu is destroyed.
+ *    @returns: @true on success, @false as tile_menu_set_tile_label().
+ *
+ *    N.B. @tile must be a tile of @menu. This replaces any update_proc already set on @tile.
+ */
+bool            tile_menu_set_tile_icon(TileMenu * menu, Layer * tile, uint32_t resource_id, GSize size);
+
+/**    Push Child Level
+ *    @brief: Pushes @child as a drill-down level of @menu, e.g. from the select_handler.
+ *            @menu keeps all of its Layers, selection and scroll offset and is hidden
+ *            until @child is popped. @child is attached to the same Window if it is
+ *            not already and takes over the button handlers, BACK pops it by default.
+ *    @returns: @true on success, @false if @menu already has a child, @child already
+ *              has a parent or @menu is not attached to a Window.
+ *
+ *    N.B. @child is owned by @menu from this point and is destroyed when popped or
+ *         when @menu is destroyed.
+ */
+bool            tile_menu_push(TileMenu * menu, TileMenu * child);
+/**    Pop Child Level
+ *    @brief: Destroys @menu and shows its parent level exactly as it was left, without
+ *            any reallocation or animation, so it is restored in a single frame.
+ *    @returns: The parent TileMenu, NULL if @menu has no parent or has a child of its own.
+ */
+TileMenu *      tile_menu_pop(TileMenu * menu);
+/**    Get Parent Level
+ *    @returns: The TileMenu @menu was pushed onto, NULL if top level or uninitialised TileMenu.
+ */
+TileMenu *      tile_menu_get_parent(TileMenu * menu);
+
+/**    Get TileMenu State
+ *    @brief: Captures the selected tile and scroll offset in a TileMenuState.
+ *    @returns: The current state, zeroed if uninitialised TileMenu.
+ */
+TileMenuState   tile_menu_get_state(TileMenu * menu);
+/**    Set TileMenu State
+ *    @brief: Moves the selector and scroll offset straight to a TileMenuState captured by
+ *            tile_menu_get_state() without animating, e.g. after rebuilding a TileMenu
+ *            in a window_load handler.
+ */
+void            tile_menu_set_state(TileMenu * menu, TileMenuState state);
+
+/**    Flick Scrolling
+ *    @brief: Enables or disables scrolling the TileMenu with wrist flicks. The accelerometer
+ *            is sampled at 25Hz and delivered in batches of @samples_per_batch, clamped to
+ *            TILE_MENU_FLICK_MIN_BATCH..TILE_MENU_FLICK_MAX_BATCH. All flicks detected in a
+ *            batch are coalesced into a single move of the selector.
+ *    @returns: @true on success, @false if another TileMenu already has flick scrolling
+ *              enabled or there is not enough heap for the detector.
+ *
+ *    N.B. Only one TileMenu can use flick scrolling at a time since it subscribes to the
+ *         accel_data_service. It is disabled automatically by tile_menu_destroy().
+ */
+bool            tile_menu_set_flick_scroll(TileMenu * menu, bool enabled, uint32_t samples_per_batch);
+
 /**    Get Next Tile Layer
  *    @brief: Returns the NEXT tile Layer in the menu if any.
  *    @returns: Layer of the NEXT tile or NULL if non available.
@@ -143,3 +396,57 @@ void            tile_menu_set_selected_next(TileMenu * menu);
  *         out of view and will shift the visible frame one tile row UP.
  */
 void            tile_menu_set_selected_prev(TileMenu * menu);
+/**    Set Selected Tile By Rows
+ *    @brief: Moves the tile selector @rows tile rows DOWN, or UP if negative, in a single
+ *            move. Unlike the NEXT and PREVIOUS methods this stops on the START or END
+ *            tile instead of looping back around.
+ *
+ *    N.B. This will trigger a single scroll event if the new tile is currently out of view.
+ */
+void            tile_menu_set_selected_rows(TileMenu * menu, int rows);
+
+/**    Set Row Height
+ *    @brief: Sets the height of tile row @row, e.g. for header rows or taller feature tiles.
+ *            Rows default to the TileMenu frame height / tiles_per_view. Each row's tiles
+ *            sit in a container Layer, so only the tiles of @row are resized and the
+ *            containers of the rows below it are moved along with the row offset table.
+ *    @returns: @true on success, @false if @row or @height is invalid, the content would
+ *              be too tall as in tile_menu_create() or there is not enough heap to grow
+ *              the catalog slots.
+ */
+bool            tile_menu_set_row_height(TileMenu * menu, unsigned row, int16_t height);
+/**    Get Row Height
+ *    @returns: The height of tile row @row, -1 if out of range or uninitialised TileMenu.
+ */
+int16_t         tile_menu_get_row_height(TileMenu * menu, unsigned row);
+/**    Get Row At Offset
+ *    @brief: Finds the tile row containing the vertical content @offset from the START row
+ *            with a binary search of the row offset table.
+ *    @returns: The row index, -1 if @offset is outside the content or uninitialised TileMenu.
+ */
+int             tile_menu_get_row_at(TileMenu * menu, int16_t offset);
+
+/**    TileMenuPool Init
+ *    @brief: Enables the app-wide TileMenuPool. From then on tile Layers, list nodes and
+ *            selectors of destroyed TileMenus are reset and kept for the next TileMenu to
+ *            be created instead of being freed, so pushing and popping TileMenu windows
+ *            does not churn and fragment the heap. Call once, e.g. in the app init().
+ *            At most TILE_MENU_POOL_MAX_TILES tiles and list nodes, TILE_MENU_POOL_MAX_ROWS
+ *            row containers and TILE_MENU_POOL_MAX_SELECTORS selectors are kept. Spare row
+ *            containers are dropped when a TileMenu is created if no live TileMenu has
+ *            their tiles_per_row.
+ *
+ *    N.B. Kept objects are freed, and nothing more is kept, while any TileMenu is in
+ *         TileMenuMemoryTierMinimal.
+ */
+void            tile_menu_pool_init(void);
+/**    TileMenuPool Deinit
+ *    @brief: Disables the TileMenuPool and frees every object it is keeping, e.g. in the
+ *            app deinit() after all TileMenus have been destroyed.
+ */
+void            tile_menu_pool_deinit(void);
+/**    Get TileMenuPool Statistics
+ *    @returns: The current TileMenuPoolStats counters, the node counters are those of
+ *              every XORList in the app as the spare nodes are shared.
+ */
+TileMenuPoolStats tile_menu_pool_get_stats(void);
@@ -0,0 +1,72 @@
+#!/usr/bin/env python
+"""TileCatalog Packer
+
+Packs a JSON or CSV tile catalog into the binary TileCatalog format read by
+tile_catalog.c, to be bundled as a "raw" resource in appinfo.json.
+
+JSON input is a list of objects, CSV input has a header row, both with the
+fields: title, subtitle, icon_id, action. Only title is required.
+
+    python tile_catalog_pack.py catalog.json resources/data/catalog.bin
+"""
+import csv
+import json
+import os
+import struct
+import sys
+
+MAGIC = b"TCAT"
+TITLE_LENGTH = 24
+SUBTITLE_LENGTH = 24
+HEADER = struct.Struct("<4sHH")
+RECORD = struct.Struct("<II%ds%ds" % (TITLE_LENGTH, SUBTITLE_LENGTH))
+MAX_RECORDS = 0xFFFF
+
+
+def load(path):
+    if os.path.splitext(path)[1].lower() == ".csv":
+        with open(path) as f:
+            return list(csv.DictReader(f))
+    with open(path) as f:
+        return json.load(f)
+
+
+def encode(text, length, field, index):
+    data = (text or "").encode("utf-8")
+    # One byte is always left for the NUL terminator
+    if len(data) >= length:
+        raise ValueError("tile %d: %s is longer than %d bytes" % (index, field, length - 1))
+    return data
+
+
+def pack(tiles):
+    if len(tiles) > MAX_RECORDS:
+        raise ValueError("catalog has %d tiles, at most %d are supported" % (len(tiles), MAX_RECORDS))
+
+    out = [HEADER.pack(MAGIC, len(tiles), RECORD.size)]
+    for index, tile in enumerate(tiles):
+        if not tile.get("title"):
+            raise ValueError("tile %d: missing title" % index)
+        out.append(RECORD.pack(int(tile.get("icon_id") or 0),
+                               int(tile.get("action") or 0),
+                               encode(tile.get("title"), TITLE_LENGTH, "title", index),
+                               encode(tile.get("subtitle"), SUBTITLE_LENGTH, "subtitle", index)))
+    return b"".join(out)
+
+
+def main(argv):
+    if len(argv) != 3:
+        sys.stderr.write("usage: %s <catalog.json|catalog.csv> <output.bin>\n" % argv[0])
+        return 2
+    try:
+        data = pack(load(argv[1]))
+    except (IOError, ValueError) as e:
+        sys.stderr.write("error: %s\n" % e)
+        return 1
+    with open(argv[2], "wb") as f:
+        f.write(data)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
@@ -22,9 +22,72 @@ struct _xorlist_ {
     int size;
 };
 
+// Freed nodes kept for reuse while recycling is enabled, linked through @npx
+static XORNode * s_spare_nodes = NULL;
+static bool s_recycle_nodes = false;
+static uint16_t s_spare_node_limit = UINT16_MAX;
+static XORListNodeStats s_node_stats;
+
+static XORNode * xorlist_node_alloc(void);
+static void xorlist_node_free(XORNode * node);
+
 
 XORNode * xorlist_xor(XORNode * x, XORNode * y) {
-    return (XORNode*) ((unsigned int)x ^ (unsigned int)y);
+    return (XORNode*) ((uintptr_t)x ^ (uintptr_t)y);
+}
+
+static XORNode * xorlist_node_alloc(void) {
+    if(!s_spare_nodes) {
+        XORNode * node = (XORNode*)malloc(sizeof(XORNode));
+        if(node)
+            s_node_stats.allocations++;
+        return node;
+    }
+
+    XORNode * node = s_spare_nodes;
+    s_spare_nodes = node->npx;
+    s_node_stats.spare--;
+    s_node_stats.reuses++;
+    return node;
+}
+
+static void xorlist_node_free(XORNode * node) {
+    if(!s_recycle_nodes || s_node_stats.spare >= s_spare_node_limit) {
+        free(node);
+        return;
+    }
+    node->npx = s_spare_nodes;
+    s_spare_nodes = node;
+    s_node_stats.spare++;
+}
+
+void xorlist_set_node_recycling(bool enabled) {
+    s_recycle_nodes = enabled;
+    if(!enabled)
+        xorlist_drain_spare_nodes();
+}
+
+void xorlist_set_spare_node_limit(uint16_t limit) {
+    s_spare_node_limit = limit;
+    while(s_node_stats.spare > s_spare_node_limit) {
+        XORNode * node = s_spare_nodes;
+        s_spare_nodes = node->npx;
+        s_node_stats.spare--;
+        free(node);
+    }
+}
+
+void xorlist_drain_spare_nodes(void) {
+    while(s_spare_nodes) {
+        XORNode * node = s_spare_nodes;
+        s_spare_nodes = node->npx;
+        free(node);
+    }
+    s_node_stats.spare = 0;
+}
+
+XORListNodeStats xorlist_get_node_stats(void) {
+    return s_node_stats;
 }
 
 XORList * xorlist_create(void) {
@@ -42,7 +105,7 @@ void xorlist_destroy(XORList * list) {
     while (curr != NULL) {
         next = xorlist_xor(prev, curr->npx);
         prev = curr;
-        free(curr);
+        xorlist_node_free(curr);
         curr = next;
     }
 
@@ -54,7 +117,10 @@ void * xorlist_push_back(XORList * list, void * e) {
     if(list == NULL)
         return NULL;
 
-    XORNode * node = (XORNode*)malloc(sizeof(XORNode));
+    XORNode * node = xorlist_node_alloc();
+    if(node == NULL)
+        return NULL;
+
     node->e = e;
     node->npx = xorlist_xor(list->tail, NULL);
 
@@ -82,7 +148,7 @@ void * xorlist_pop_back(XORList * list) {
     list->tail = prev;
     list->tail->npx = prevprev;
 
-    free(old);
+    xorlist_node_free(old);
     list->size--;
     return old_e;
 }
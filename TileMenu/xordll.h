@@ -42,6 +42,42 @@ XORItem *       xorlist_pop_back(XORList * list);
 bool            xorlist_is_empty(XORList * list);
 int             xorlist_size(XORList * list);
 
+/** Node Recycling **
+ *
+ *  @brief: While enabled, nodes freed by any @XORList are kept and reused
+ *          by the next push instead of going back to the heap. Disabling
+ *          frees every kept node. Disabled by default.
+ */
+void            xorlist_set_node_recycling(bool enabled);
+/** Spare Node Limit **
+ *
+ *  @brief: Most nodes kept while recycling, nodes freed past it go back to
+ *          the heap. Spare nodes past a lowered limit are freed straight away.
+ *          UINT16_MAX by default.
+ */
+void            xorlist_set_spare_node_limit(uint16_t limit);
+/** Drain Spare Nodes **
+ *
+ *  @brief: Frees every kept node without changing whether nodes are recycled.
+ */
+void            xorlist_drain_spare_nodes(void);
+
+/** Node Statistics **
+ *
+ *  @brief: Counters of the nodes allocated by all @XORList objects.
+ *
+ *          @spare          Nodes currently kept for reuse
+ *          @allocations    Nodes allocated from the heap since start up
+ *          @reuses         Nodes taken from the kept nodes instead of the heap
+ */
+typedef struct _xorlist_node_stats_ {
+    uint16_t spare;
+    uint32_t allocations;
+    uint32_t reuses;
+} XORListNodeStats;
+
+XORListNodeStats xorlist_get_node_stats(void);
+
 /** XORLIST ITERATOR **
  *
  *  @brief: Iterators are bi-directional but initialised